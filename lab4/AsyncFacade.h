@@ -0,0 +1,273 @@
+#pragma once
+#include "FacadeSystem.h"
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+
+// === Асинхронный Фасад (Async Facade) ===
+// Ветви "авиабилеты", "отель" и "питание" независимы, поэтому выполняются
+// параллельно и объединяются в один результат бронирования. Каждый шаг
+// ограничен своим таймаутом; при сбое любой ветви уже подтвержденные
+// бронирования других ветвей отменяются (компенсация). Шаги выполняются
+// в ограниченном пуле потоков фасада; подтверждение, не уложившееся в таймаут,
+// считается неизвестным: фасад дожидается его и при успехе тоже отменяет.
+
+using FacadeClock = std::chrono::steady_clock;
+
+// === 1. Шаги бронирования и их профиль ===
+enum class TourStep { FindTickets, BookSeat, FindHotel, ReserveRoom, SelectMealPlan, PayForMealPlan, Count };
+
+constexpr size_t kTourStepCount = static_cast<size_t>(TourStep::Count);
+
+inline const char* TourStepName(TourStep step) {
+    static const char* names[] = {"FindTickets", "BookSeat", "FindHotel", "ReserveRoom", "SelectMealPlan", "PayForMealPlan"};
+    return names[static_cast<size_t>(step)];
+}
+
+// Имитация задержек и сбоев подсистем и таймауты шагов
+struct TourStepProfile {
+    std::array<std::chrono::milliseconds, kTourStepCount> latency{};
+    std::array<std::chrono::milliseconds, kTourStepCount> timeout{};
+    std::array<bool, kTourStepCount> fail{};
+
+    TourStepProfile() {
+        latency.fill(std::chrono::milliseconds(0));
+        timeout.fill(std::chrono::milliseconds(1000));
+        fail.fill(false);
+    }
+};
+
+class TourStepError : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+// Пул потоков шагов: число потоков ограничено, задачи ждут в очереди.
+// Деструктор дожидается всех задач, в том числе брошенных по таймауту
+class StepExecutor {
+private:
+    std::vector<std::thread> workers_;
+    std::queue<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_ = false;
+
+public:
+    explicit StepExecutor(size_t threadCount) {
+        for (size_t i = 0; i < std::max<size_t>(1, threadCount); ++i) {
+            workers_.emplace_back([this] {
+                for (;;) {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        cv_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+                        if (stopping_ && tasks_.empty()) return;
+                        task = std::move(tasks_.front());
+                        tasks_.pop();
+                    }
+                    task();
+                }
+            });
+        }
+    }
+
+    ~StepExecutor() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        for (auto& worker : workers_) worker.join();
+    }
+
+    void Submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push(std::move(task));
+        }
+        cv_.notify_one();
+    }
+};
+
+// === 2. Результат бронирования ===
+struct BookingResult {
+    bool confirmed = false;
+    std::vector<std::string> log;  // Ответы подсистем в порядке ветвей
+    std::string failure;           // Причина отказа, если confirmed == false
+    std::chrono::microseconds elapsed{0};
+};
+
+// === 3. Асинхронный Фасад ===
+class AsyncTourismFacade {
+private:
+    // Подсистемы разделяются с задачами пула: шаг, переживший свой таймаут,
+    // выполняется до конца и обращается к ним уже после возврата OrganizeTour
+    struct Subsystems {
+        HotelBookingSystem hotel;
+        FlightBookingSystem flight;
+        CateringSystem catering;
+    };
+    std::shared_ptr<const Subsystems> systems_ = std::make_shared<Subsystems>();
+    TourStepProfile profile_;
+    // Объявлен после systems_: разрушается первым и дожидается брошенных шагов
+    std::shared_ptr<StepExecutor> executor_;
+
+    struct BranchResult {
+        bool committed = false; // Бронирование ветви подтверждено
+        std::shared_future<std::string> uncertain; // Подтверждение, брошенное по таймауту
+        std::vector<std::string> log;
+        std::string error;
+    };
+
+    // Ставит шаг в пул; результат или ошибка — через future
+    template <typename Func>
+    std::shared_future<std::string> SubmitStep(TourStep step, Func func) const {
+        auto promise = std::make_shared<std::promise<std::string>>();
+        std::shared_future<std::string> future = promise->get_future().share();
+        std::chrono::milliseconds latency = profile_.latency[static_cast<size_t>(step)];
+        bool fail = profile_.fail[static_cast<size_t>(step)];
+        executor_->Submit([promise, func, latency, fail, step] {
+            std::this_thread::sleep_for(latency);
+            if (fail) {
+                promise->set_exception(std::make_exception_ptr(
+                    TourStepError(std::string(TourStepName(step)) + " failed")));
+                return;
+            }
+            promise->set_value(func());
+        });
+        return future;
+    }
+
+    bool WaitStep(TourStep step, const std::shared_future<std::string>& future) const {
+        return future.wait_for(profile_.timeout[static_cast<size_t>(step)]) == std::future_status::ready;
+    }
+
+    static TourStepError TimedOut(TourStep step) {
+        return TourStepError(std::string(TourStepName(step)) + " timed out");
+    }
+
+    // Ветвь: поиск + бронирование; ошибка фиксируется в результате ветви.
+    // Поиск без побочных эффектов можно бросить; бронирование по таймауту — неизвестно
+    template <typename FindFunc, typename BookFunc>
+    BranchResult RunBranch(TourStep findStep, FindFunc find, TourStep bookStep, BookFunc book) const {
+        BranchResult branch;
+        try {
+            std::shared_future<std::string> found = SubmitStep(findStep, find);
+            if (!WaitStep(findStep, found)) throw TimedOut(findStep);
+            branch.log.push_back(found.get());
+            std::shared_future<std::string> booked = SubmitStep(bookStep, book);
+            if (!WaitStep(bookStep, booked)) {
+                branch.uncertain = booked;
+                throw TimedOut(bookStep);
+            }
+            branch.log.push_back(booked.get());
+            branch.committed = true;
+        } catch (const std::exception& e) {
+            branch.error = e.what();
+        }
+        return branch;
+    }
+
+    // Отмена бронирования ветви; неизвестное подтверждение сначала дожидается
+    template <typename CancelFunc>
+    static void Compensate(BranchResult& branch, BookingResult& result, CancelFunc cancel) {
+        if (branch.uncertain.valid()) {
+            try {
+                result.log.push_back(branch.uncertain.get() + " (after timeout)");
+                branch.committed = true;
+            } catch (const std::exception&) {
+                // Подтверждение не прошло — отменять нечего
+            }
+        }
+        if (branch.committed) result.log.push_back(cancel());
+    }
+
+public:
+    // threadCount — потоки пула шагов; по умолчанию по одному на ветвь
+    explicit AsyncTourismFacade(const TourStepProfile& profile = TourStepProfile(), size_t threadCount = 3)
+        : profile_(profile), executor_(std::make_shared<StepExecutor>(threadCount)) {}
+
+    BookingResult OrganizeTour(const std::string& city, int stars, const std::string& mealPlan) const {
+        FacadeClock::time_point start = FacadeClock::now();
+        std::shared_ptr<const Subsystems> sys = systems_;
+
+        // 1. Три независимые ветви запускаются параллельно
+        auto flight = std::async(std::launch::async, [&] {
+            return RunBranch(TourStep::FindTickets, [sys, city] { return sys->flight.FindTickets(city); },
+                             TourStep::BookSeat, [sys] { return sys->flight.BookSeat(); });
+        });
+        auto hotel = std::async(std::launch::async, [&] {
+            return RunBranch(TourStep::FindHotel, [sys, city, stars] { return sys->hotel.FindHotel(city, stars); },
+                             TourStep::ReserveRoom, [sys] { return sys->hotel.ReserveRoom(); });
+        });
+        auto catering = std::async(std::launch::async, [&] {
+            return RunBranch(TourStep::SelectMealPlan, [sys, mealPlan] { return sys->catering.SelectMealPlan(mealPlan); },
+                             TourStep::PayForMealPlan, [sys] { return sys->catering.PayForMealPlan(); });
+        });
+
+        // 2. Объединение результатов
+        BranchResult branches[] = {flight.get(), hotel.get(), catering.get()};
+        BookingResult result;
+        result.confirmed = true;
+        for (const BranchResult& branch : branches) {
+            result.log.insert(result.log.end(), branch.log.begin(), branch.log.end());
+            if (!branch.error.empty()) {
+                result.confirmed = false;
+                if (!result.failure.empty()) result.failure += "; ";
+                result.failure += branch.error;
+            }
+        }
+
+        // 3. Компенсация: отменяем подтвержденные и неизвестные бронирования всех ветвей
+        if (!result.confirmed) {
+            Compensate(branches[0], result, [&] { return sys->flight.CancelSeat(); });
+            Compensate(branches[1], result, [&] { return sys->hotel.CancelReservation(); });
+            Compensate(branches[2], result, [&] { return sys->catering.RefundMealPlan(); });
+        }
+
+        result.elapsed = std::chrono::duration_cast<std::chrono::microseconds>(FacadeClock::now() - start);
+        return result;
+    }
+
+    // Последовательный вариант с теми же задержками — для сравнения
+    BookingResult OrganizeTourSequential(const std::string& city, int stars, const std::string& mealPlan) const {
+        FacadeClock::time_point start = FacadeClock::now();
+        std::shared_ptr<const Subsystems> sys = systems_;
+        BookingResult result;
+        auto step = [&](TourStep id) {
+            std::this_thread::sleep_for(profile_.latency[static_cast<size_t>(id)]);
+        };
+        step(TourStep::FindTickets);    result.log.push_back(sys->flight.FindTickets(city));
+        step(TourStep::BookSeat);       result.log.push_back(sys->flight.BookSeat());
+        step(TourStep::FindHotel);      result.log.push_back(sys->hotel.FindHotel(city, stars));
+        step(TourStep::ReserveRoom);    result.log.push_back(sys->hotel.ReserveRoom());
+        step(TourStep::SelectMealPlan); result.log.push_back(sys->catering.SelectMealPlan(mealPlan));
+        step(TourStep::PayForMealPlan); result.log.push_back(sys->catering.PayForMealPlan());
+        result.confirmed = true;
+        result.elapsed = std::chrono::duration_cast<std::chrono::microseconds>(FacadeClock::now() - start);
+        return result;
+    }
+};
+
+// Вывод результата в стиле TourismFacade::OrganizeTour
+inline void PrintBooking(const std::string& city, const BookingResult& result) {
+    std::cout << "\n========================================================" << std::endl;
+    std::cout << "[ASYNC FACADE] Tour organization to " << city << std::endl;
+    std::cout << "========================================================" << std::endl;
+    for (const std::string& line : result.log) {
+        std::cout << line << std::endl;
+    }
+    if (result.confirmed) {
+        std::cout << "\n[ASYNC FACADE] Tour successfully organized and confirmed";
+    } else {
+        std::cout << "\n[ASYNC FACADE] Tour cancelled: " << result.failure;
+    }
+    std::cout << " (" << result.elapsed.count() / 1000.0 << " ms)." << std::endl;
+}
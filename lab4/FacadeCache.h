@@ -0,0 +1,211 @@
+#pragma once
+#include "FacadeSystem.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+// === Кэширование результатов подсистем Фасада ===
+// FindHotel(city, stars) и FindTickets(city) — чистые функции, поэтому их
+// результаты кэшируются. Сегмент (shard) выбирается по хешу самого запроса, без
+// общего для всех потоков словаря городов: поиск берет только мьютекс своего
+// сегмента. Название города хранится в записи кэша, а записи ограничены по
+// времени жизни (TTL) и по количеству (LRU), поэтому память не растет с числом
+// разных городов в потоке запросов.
+
+using CacheClock = std::chrono::steady_clock;
+
+// === 1. Ключ поиска отеля ===
+struct HotelQuery {
+    std::string city;
+    int stars;
+
+    bool operator==(const HotelQuery& other) const { return stars == other.stars && city == other.city; }
+};
+
+struct HotelQueryHash {
+    size_t operator()(const HotelQuery& query) const {
+        return std::hash<std::string>()(query.city) ^ (static_cast<size_t>(query.stars) * 0x9E3779B97F4A7C15ull);
+    }
+};
+
+// === 2. Счетчики кэша ===
+struct CacheCounters {
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> expirations{0};
+    std::atomic<uint64_t> evictions{0};
+    std::atomic<uint64_t> lookupNanos{0}; // Суммарное время поиска
+
+    double HitRate() const {
+        uint64_t total = hits.load() + misses.load();
+        return total ? static_cast<double>(hits.load()) / total : 0.0;
+    }
+
+    double AvgLookupNanos() const {
+        uint64_t total = hits.load() + misses.load();
+        return total ? static_cast<double>(lookupNanos.load()) / total : 0.0;
+    }
+};
+
+// === 3. Сегментированный кэш с TTL и LRU-вытеснением ===
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class ShardedTtlCache {
+private:
+    struct Entry {
+        Key key;
+        std::shared_ptr<const Value> value;
+        CacheClock::time_point expiresAt;
+    };
+
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::list<Entry> lru; // Начало — самые свежие записи
+        std::unordered_map<Key, typename std::list<Entry>::iterator, Hash> index;
+    };
+
+    std::vector<Shard> shards_;
+    size_t capacityPerShard_;
+    std::chrono::milliseconds ttl_;
+    CacheCounters counters_;
+
+    Shard& ShardFor(const Key& key) {
+        // Перемешивание: у std::hash целых и строк младшие биты распределены плохо
+        uint64_t h = static_cast<uint64_t>(Hash()(key)) * 0x9E3779B97F4A7C15ull;
+        return shards_[(h >> 32) % shards_.size()];
+    }
+
+public:
+    ShardedTtlCache(size_t shardCount, size_t capacity, std::chrono::milliseconds ttl)
+        : shards_(shardCount), ttl_(ttl) {
+        if (shardCount == 0) throw std::invalid_argument("ShardedTtlCache: shardCount must be positive");
+        capacityPerShard_ = std::max<size_t>(1, capacity / shardCount);
+    }
+
+    // Возвращает значение из кэша или вычисляет его через compute()
+    template <typename Compute>
+    std::shared_ptr<const Value> GetOrCompute(const Key& key, Compute compute) {
+        CacheClock::time_point start = CacheClock::now();
+        Shard& shard = ShardFor(key);
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto it = shard.index.find(key);
+            if (it != shard.index.end()) {
+                if (it->second->expiresAt > start) {
+                    shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+                    std::shared_ptr<const Value> value = it->second->value;
+                    counters_.hits.fetch_add(1, std::memory_order_relaxed);
+                    counters_.lookupNanos.fetch_add(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(CacheClock::now() - start).count(),
+                        std::memory_order_relaxed);
+                    return value;
+                }
+                shard.lru.erase(it->second);
+                shard.index.erase(it);
+                counters_.expirations.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        // Вычисление вне блокировки сегмента
+        auto value = std::make_shared<const Value>(compute());
+        counters_.misses.fetch_add(1, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto it = shard.index.find(key);
+            if (it != shard.index.end()) {
+                // Параллельный промах уже заполнил запись
+                shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+            } else {
+                shard.lru.push_front({key, value, start + ttl_});
+                shard.index.emplace(key, shard.lru.begin());
+                if (shard.lru.size() > capacityPerShard_) {
+                    shard.index.erase(shard.lru.back().key);
+                    shard.lru.pop_back();
+                    counters_.evictions.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+        counters_.lookupNanos.fetch_add(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(CacheClock::now() - start).count(),
+            std::memory_order_relaxed);
+        return value;
+    }
+
+    // Число записей во всех сегментах (не больше емкости)
+    size_t Size() {
+        size_t total = 0;
+        for (Shard& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            total += shard.lru.size();
+        }
+        return total;
+    }
+
+    const CacheCounters& GetCounters() const { return counters_; }
+};
+
+// === 4. Фасад с кэшированием поиска ===
+class CachedTourismFacade {
+private:
+    HotelBookingSystem hotelSystem_;
+    FlightBookingSystem flightSystem_;
+    CateringSystem cateringSystem_;
+
+    ShardedTtlCache<HotelQuery, std::string, HotelQueryHash> hotelCache_;
+    ShardedTtlCache<std::string, std::string> ticketCache_;
+    std::chrono::nanoseconds backendCost_; // Имитация стоимости удаленного поиска при промахе
+
+    void SimulateBackend() const {
+        if (backendCost_.count() == 0) return;
+        CacheClock::time_point until = CacheClock::now() + backendCost_;
+        while (CacheClock::now() < until) {
+        }
+    }
+
+public:
+    CachedTourismFacade(size_t shardCount = 16, size_t capacity = 4096,
+                        std::chrono::milliseconds ttl = std::chrono::minutes(10),
+                        std::chrono::nanoseconds backendCost = std::chrono::nanoseconds(0))
+        : hotelCache_(shardCount, capacity, ttl), ticketCache_(shardCount, capacity, ttl), backendCost_(backendCost) {}
+
+    std::shared_ptr<const std::string> FindHotel(const std::string& city, int stars) {
+        return hotelCache_.GetOrCompute(HotelQuery{city, stars}, [&] {
+            SimulateBackend();
+            return hotelSystem_.FindHotel(city, stars);
+        });
+    }
+
+    std::shared_ptr<const std::string> FindTickets(const std::string& city) {
+        return ticketCache_.GetOrCompute(city, [&] {
+            SimulateBackend();
+            return flightSystem_.FindTickets(city);
+        });
+    }
+
+    // Тот же сценарий, что и TourismFacade::OrganizeTour, но с кэшированным поиском
+    void OrganizeTour(const std::string& city, int stars, const std::string& mealPlan) {
+        std::cout << "\n========================================================" << std::endl;
+        std::cout << "[FACADE] Starting tour organization to " << city << std::endl;
+        std::cout << "========================================================" << std::endl;
+
+        std::cout << *FindTickets(city) << std::endl;
+        std::cout << flightSystem_.BookSeat() << std::endl;
+
+        std::cout << *FindHotel(city, stars) << std::endl;
+        std::cout << hotelSystem_.ReserveRoom() << std::endl;
+
+        std::cout << cateringSystem_.SelectMealPlan(mealPlan) << std::endl;
+        std::cout << cateringSystem_.PayForMealPlan() << std::endl;
+
+        std::cout << "\n[FACADE] Tour successfully organized and confirmed." << std::endl;
+    }
+
+    const CacheCounters& GetHotelCounters() const { return hotelCache_.GetCounters(); }
+    const CacheCounters& GetTicketCounters() const { return ticketCache_.GetCounters(); }
+    size_t GetCachedEntries() { return hotelCache_.Size() + ticketCache_.Size(); }
+};
@@ -2,6 +2,10 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <ostream>
+#include <unordered_map>
+#include <string_view>
+#include <algorithm>
 
 // === 1. Подсистема A: Бронирование Отелей (Subsystem) ===
 class HotelBookingSystem {
@@ -18,6 +22,9 @@ public:
     std::string ReserveRoom() const {
         return " -> Hotel: Room reservation confirmed.";
     }
+    std::string CancelReservation() const {
+        return " -> Hotel: Room reservation cancelled.";
+    }
 };
 
 // === 2. Подсистема B: Бронирование Авиабилетов (Subsystem) ===
@@ -29,6 +36,9 @@ public:
     std::string BookSeat() const {
         return " -> Tickets: Seat booked.";
     }
+    std::string CancelSeat() const {
+        return " -> Tickets: Seat booking cancelled.";
+    }
 };
 
 // === 3. Подсистема C: Выбор Питания (Subsystem) ===
@@ -44,6 +54,52 @@ public:
     std::string PayForMealPlan() const {
         return " -> Catering: Payment confirmed.";
     }
+    std::string RefundMealPlan() const {
+        return " -> Catering: Payment refunded.";
+    }
+};
+
+// Запрос на организацию тура (для пакетной обработки)
+struct TourRequest {
+    std::string city;
+    int stars;
+    std::string mealPlan;
+};
+
+// Буферизованный приемник вывода: накапливает текст и пишет его крупными блоками
+class TourOutputBuffer {
+private:
+    std::ostream& out_;
+    std::string buffer_;
+    size_t flushThreshold_;
+
+public:
+    explicit TourOutputBuffer(std::ostream& out, size_t flushThreshold = 1 << 16)
+        : out_(out), flushThreshold_(flushThreshold) {
+        buffer_.reserve(flushThreshold + 1024);
+    }
+    ~TourOutputBuffer() { Flush(); }
+
+    // Добавляет текст без перевода строки
+    TourOutputBuffer& Write(std::string_view text) {
+        buffer_.append(text.data(), text.size());
+        return *this;
+    }
+
+    // Добавляет строку текста
+    TourOutputBuffer& Append(std::string_view text) {
+        Write(text);
+        buffer_ += '\n';
+        if (buffer_.size() >= flushThreshold_) Flush();
+        return *this;
+    }
+
+    void Flush() {
+        if (buffer_.empty()) return;
+        out_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        out_.flush();
+        buffer_.clear();
+    }
 };
 
 // === 4. Фасад (Facade) ===
@@ -76,4 +132,55 @@ public:
         
         std::cout << "\n[FACADE] Tour successfully organized and confirmed." << std::endl;
     }
+
+    // Пакетный метод: запросы группируются по (город, питание), поиск в
+    // подсистемах выполняется один раз на группу, а результаты раздаются всем
+    // запросам группы. Вывод идет через буфер в порядке исходных запросов.
+    void OrganizeTours(const std::vector<TourRequest>& requests, std::ostream& out = std::cout) const {
+        struct Group {
+            std::string tickets;
+            std::string meal;
+            std::vector<std::pair<int, std::string>> hotels; // Поиск отеля по числу звезд
+        };
+        std::unordered_map<std::string, Group> groups;
+        std::vector<std::pair<const Group*, size_t>> resolved(requests.size()); // Группа и индекс отеля
+
+        // 1. Поиск: один раз на группу и на категорию отеля внутри группы
+        for (size_t i = 0; i < requests.size(); ++i) {
+            const TourRequest& request = requests[i];
+            std::string key = request.city;
+            key += '\0';
+            key += request.mealPlan;
+            auto inserted = groups.try_emplace(std::move(key));
+            Group& group = inserted.first->second;
+            if (inserted.second) {
+                group.tickets = flightSystem_.FindTickets(request.city);
+                group.meal = cateringSystem_.SelectMealPlan(request.mealPlan);
+            }
+            auto hotel = std::find_if(group.hotels.begin(), group.hotels.end(),
+                                      [&](const auto& entry) { return entry.first == request.stars; });
+            if (hotel == group.hotels.end()) {
+                group.hotels.emplace_back(request.stars, hotelSystem_.FindHotel(request.city, request.stars));
+                hotel = group.hotels.end() - 1;
+            }
+            resolved[i] = {&group, static_cast<size_t>(hotel - group.hotels.begin())};
+        }
+
+        // 2. Бронирование и вывод для каждого запроса
+        const std::string seat = flightSystem_.BookSeat();
+        const std::string room = hotelSystem_.ReserveRoom();
+        const std::string payment = cateringSystem_.PayForMealPlan();
+        const std::string separator = "========================================================";
+        TourOutputBuffer sink(out);
+        for (size_t i = 0; i < requests.size(); ++i) {
+            const Group& group = *resolved[i].first;
+            sink.Append("").Append(separator);
+            sink.Write("[FACADE] Starting tour organization to ").Append(requests[i].city);
+            sink.Append(separator);
+            sink.Append(group.tickets).Append(seat);
+            sink.Append(group.hotels[resolved[i].second].second).Append(room);
+            sink.Append(group.meal).Append(payment);
+            sink.Append("").Append("[FACADE] Tour successfully organized and confirmed.");
+        }
+    }
 };
\ No newline at end of file
@@ -0,0 +1,324 @@
+#pragma once
+#include "AdapterSystem.h"
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <queue>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+
+// === Подсистема опроса датчиков (Polling) ===
+// Планирует опрос множества ITargetSensor с разной частотой на колесе таймеров,
+// выполняет чтение асинхронно в пуле потоков и складывает результаты
+// в lock-free кольцевой буфер для потребителей.
+
+using PollClock = std::chrono::steady_clock;
+
+// === 1. Результат опроса ===
+struct SensorReading {
+    size_t sensorId = 0;
+    double celsius = 0.0;
+    PollClock::time_point scheduledAt; // Момент, когда опрос должен был начаться
+    PollClock::time_point deliveredAt; // Момент, когда значение попало в буфер
+};
+
+// === 2. Датчик с имитацией задержки ввода-вывода ===
+// Адаптирует LegacyFahrenheitSensor-подобный источник, но без вывода в консоль,
+// чтобы не искажать замеры. Задержка чтения задается в конструкторе.
+class SimulatedLatencySensor : public ITargetSensor {
+private:
+    double tempFahrenheit_;
+    std::chrono::microseconds latency_;
+
+public:
+    SimulatedLatencySensor(double tempFahrenheit, std::chrono::microseconds latency)
+        : tempFahrenheit_(tempFahrenheit), latency_(latency) {}
+
+    double GetTemperatureCelsius() const override {
+        if (latency_.count() > 0) {
+            std::this_thread::sleep_for(latency_);
+        }
+        return (tempFahrenheit_ - 32.0) * 5.0 / 9.0;
+    }
+};
+
+// === 3. Lock-free кольцевой буфер (ограниченная MPMC очередь Вьюкова) ===
+// Емкость должна быть степенью двойки.
+template <typename T>
+class LockFreeRing {
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+    std::vector<Cell> cells_;
+    size_t mask_;
+    alignas(64) std::atomic<size_t> head_{0}; // Позиция записи
+    alignas(64) std::atomic<size_t> tail_{0}; // Позиция чтения
+
+public:
+    explicit LockFreeRing(size_t capacity) : cells_(capacity), mask_(capacity - 1) {
+        for (size_t i = 0; i < capacity; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool TryPush(const T& value) {
+        size_t pos = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & mask_];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.data = value;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // Буфер заполнен
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool TryPop(T& out) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & mask_];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    out = cell.data;
+                    cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // Буфер пуст
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    size_t Capacity() const { return mask_ + 1; }
+};
+
+// === 4. Пул потоков ===
+class ThreadPool {
+private:
+    std::vector<std::thread> workers_;
+    std::queue<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_ = false;
+
+public:
+    explicit ThreadPool(size_t threadCount) {
+        for (size_t i = 0; i < threadCount; ++i) {
+            workers_.emplace_back([this] {
+                for (;;) {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        cv_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+                        if (stopping_ && tasks_.empty()) return;
+                        task = std::move(tasks_.front());
+                        tasks_.pop();
+                    }
+                    task();
+                }
+            });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        for (auto& worker : workers_) worker.join();
+    }
+
+    void Submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push(std::move(task));
+        }
+        cv_.notify_one();
+    }
+};
+
+// === 5. Колесо таймеров (Hashed Timing Wheel) ===
+// Каждая ячейка соответствует одному тику; задачи с периодом больше оборота
+// колеса хранят счетчик оставшихся оборотов.
+class TimerWheel {
+public:
+    struct Entry {
+        size_t taskId;
+        size_t rounds;
+    };
+
+private:
+    std::vector<std::vector<Entry>> slots_;
+    size_t current_ = 0;
+
+public:
+    explicit TimerWheel(size_t slotCount) : slots_(slotCount) {}
+
+    // Планирует задачу через ticks тиков (минимум 1)
+    void Schedule(size_t taskId, size_t ticks) {
+        if (ticks == 0) ticks = 1;
+        size_t slot = (current_ + ticks) % slots_.size();
+        size_t rounds = (ticks - 1) / slots_.size();
+        slots_[slot].push_back({taskId, rounds});
+    }
+
+    // Продвигает колесо на один тик и возвращает созревшие задачи
+    void Advance(std::vector<size_t>& expired) {
+        current_ = (current_ + 1) % slots_.size();
+        auto& bucket = slots_[current_];
+        size_t keep = 0;
+        for (auto& entry : bucket) {
+            if (entry.rounds == 0) {
+                expired.push_back(entry.taskId);
+            } else {
+                --entry.rounds;
+                bucket[keep++] = entry;
+            }
+        }
+        bucket.resize(keep);
+    }
+};
+
+// === 6. Планировщик опроса датчиков ===
+class SensorPoller {
+private:
+    struct PollTask {
+        const ITargetSensor* sensor;
+        size_t periodTicks;
+        PollClock::time_point dueAt;
+        std::atomic<bool> inFlight{false};
+    };
+
+    std::chrono::microseconds tick_;
+    std::vector<std::unique_ptr<PollTask>> tasks_;
+    TimerWheel wheel_;
+    LockFreeRing<SensorReading> ring_;
+    std::thread scheduler_;
+    std::atomic<bool> running_{false};
+
+    std::atomic<uint64_t> completed_{0};
+    std::atomic<uint64_t> skipped_{0}; // Опрос пропущен: предыдущее чтение еще идет
+    std::atomic<uint64_t> dropped_{0}; // Буфер был полон
+
+    // Пул объявлен последним: разрушается первым и дожидается задач,
+    // которые еще обращаются к буферу и счетчикам
+    ThreadPool pool_;
+
+    void Dispatch(size_t taskId) {
+        PollTask* task = tasks_[taskId].get();
+        PollClock::time_point due = task->dueAt;
+        task->dueAt += tick_ * task->periodTicks;
+        wheel_.Schedule(taskId, task->periodTicks);
+
+        if (task->inFlight.exchange(true, std::memory_order_acq_rel)) {
+            skipped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        pool_.Submit([this, task, taskId, due] {
+            SensorReading reading;
+            reading.sensorId = taskId;
+            reading.scheduledAt = due;
+            reading.celsius = task->sensor->GetTemperatureCelsius();
+            reading.deliveredAt = PollClock::now();
+            if (ring_.TryPush(reading)) {
+                completed_.fetch_add(1, std::memory_order_relaxed);
+            } else {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+            }
+            task->inFlight.store(false, std::memory_order_release);
+        });
+    }
+
+    void SchedulerLoop() {
+        std::vector<size_t> expired;
+        PollClock::time_point nextTick = PollClock::now() + tick_;
+        while (running_.load(std::memory_order_acquire)) {
+            std::this_thread::sleep_until(nextTick);
+            nextTick += tick_;
+            expired.clear();
+            wheel_.Advance(expired);
+            for (size_t taskId : expired) {
+                Dispatch(taskId);
+            }
+        }
+    }
+
+public:
+    SensorPoller(std::chrono::microseconds tick, size_t wheelSlots, size_t workerThreads, size_t ringCapacity)
+        : tick_(tick), wheel_(wheelSlots), ring_(ringCapacity), pool_(workerThreads) {}
+
+    ~SensorPoller() { Stop(); }
+
+    // Регистрирует датчик с периодом опроса; вызывать до Start()
+    size_t AddSensor(const ITargetSensor* sensor, std::chrono::microseconds period) {
+        auto task = std::make_unique<PollTask>();
+        task->sensor = sensor;
+        task->periodTicks = std::max<size_t>(1, static_cast<size_t>(period / tick_));
+        tasks_.push_back(std::move(task));
+        return tasks_.size() - 1;
+    }
+
+    void Start() {
+        PollClock::time_point now = PollClock::now();
+        for (size_t id = 0; id < tasks_.size(); ++id) {
+            tasks_[id]->dueAt = now + tick_ * tasks_[id]->periodTicks;
+            wheel_.Schedule(id, tasks_[id]->periodTicks);
+        }
+        running_.store(true, std::memory_order_release);
+        scheduler_ = std::thread([this] { SchedulerLoop(); });
+    }
+
+    void Stop() {
+        if (running_.exchange(false)) {
+            scheduler_.join();
+        }
+    }
+
+    // Неблокирующее получение результата потребителем
+    bool TryConsume(SensorReading& out) { return ring_.TryPop(out); }
+
+    uint64_t GetCompleted() const { return completed_.load(); }
+    uint64_t GetSkipped() const { return skipped_.load(); }
+    uint64_t GetDropped() const { return dropped_.load(); }
+};
+
+// === 7. Статистика задержки доставки ===
+class LatencyStats {
+private:
+    std::vector<double> samplesUs_;
+
+public:
+    void Add(const SensorReading& reading) {
+        samplesUs_.push_back(
+            std::chrono::duration<double, std::micro>(reading.deliveredAt - reading.scheduledAt).count());
+    }
+
+    size_t Count() const { return samplesUs_.size(); }
+
+    // Перцентиль в микросекундах (p в диапазоне [0, 1])
+    double Percentile(double p) {
+        if (samplesUs_.empty()) return 0.0;
+        size_t index = static_cast<size_t>(p * (samplesUs_.size() - 1));
+        std::nth_element(samplesUs_.begin(), samplesUs_.begin() + index, samplesUs_.end());
+        return samplesUs_[index];
+    }
+};
@@ -0,0 +1,364 @@
+#pragma once
+#include "AdapterSystem.h"
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <functional>
+
+// === Хранилище временных рядов для показаний датчиков ===
+// Компактное хранение в стиле Gorilla: метки времени кодируются разностью
+// разностей (delta-of-delta), значения — XOR с предыдущим значением.
+// Старые блоки вытесняются по кольцу, а агрегаты min/max/avg
+// предварительно считаются на нескольких разрешениях.
+
+// === 1. Битовый поток ===
+class BitWriter {
+private:
+    std::vector<uint64_t> words_;
+    size_t bitCount_ = 0;
+
+public:
+    // Записывает младшие bits бит значения, начиная со старшего
+    void Write(uint64_t value, int bits) {
+        if (bits == 0) return;
+        if (bits < 64) value &= (uint64_t(1) << bits) - 1;
+        size_t offset = bitCount_ & 63;
+        if (offset == 0) words_.push_back(0);
+        size_t freeBits = 64 - offset;
+        if (static_cast<size_t>(bits) <= freeBits) {
+            words_.back() |= value << (freeBits - bits);
+        } else {
+            size_t rest = bits - freeBits;
+            words_.back() |= value >> rest;
+            words_.push_back(value << (64 - rest));
+        }
+        bitCount_ += bits;
+    }
+
+    void Clear() {
+        words_.clear();
+        bitCount_ = 0;
+    }
+
+    const std::vector<uint64_t>& GetWords() const { return words_; }
+    size_t GetBitCount() const { return bitCount_; }
+    size_t GetCapacityBytes() const { return words_.capacity() * sizeof(uint64_t); }
+};
+
+class BitReader {
+private:
+    const std::vector<uint64_t>& words_;
+    size_t position_ = 0;
+
+public:
+    explicit BitReader(const std::vector<uint64_t>& words) : words_(words) {}
+
+    uint64_t Read(int bits) {
+        if (bits == 0) return 0;
+        size_t index = position_ >> 6;
+        size_t offset = position_ & 63;
+        size_t available = 64 - offset;
+        uint64_t result;
+        if (static_cast<size_t>(bits) <= available) {
+            result = (words_[index] << offset) >> (64 - bits);
+        } else {
+            size_t rest = bits - available;
+            uint64_t high = (words_[index] << offset) >> offset;
+            result = (high << rest) | (words_[index + 1] >> (64 - rest));
+        }
+        position_ += bits;
+        return result;
+    }
+
+    bool ReadBit() { return Read(1) != 0; }
+};
+
+// === 2. Сжатый блок точек ===
+class CompressedBlock {
+private:
+    BitWriter bits_;
+    size_t count_ = 0;
+    int64_t firstTimestamp_ = 0;
+    int64_t lastTimestamp_ = 0;
+    int64_t lastDelta_ = 0;
+    uint64_t lastValueBits_ = 0;
+    int prevLeading_ = -1;
+    int prevTrailing_ = 0;
+
+    static uint64_t ToBits(double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    static double FromBits(uint64_t bits) {
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    static int64_t SignExtend(uint64_t value, int bits) {
+        uint64_t sign = uint64_t(1) << (bits - 1);
+        return static_cast<int64_t>((value ^ sign) - sign);
+    }
+
+    void WriteTimestamp(int64_t timestamp) {
+        int64_t delta = timestamp - lastTimestamp_;
+        int64_t dod = delta - lastDelta_;
+        if (dod == 0) {
+            bits_.Write(0b0, 1);
+        } else if (dod >= -64 && dod <= 63) {
+            bits_.Write(0b10, 2);
+            bits_.Write(static_cast<uint64_t>(dod), 7);
+        } else if (dod >= -256 && dod <= 255) {
+            bits_.Write(0b110, 3);
+            bits_.Write(static_cast<uint64_t>(dod), 9);
+        } else if (dod >= -2048 && dod <= 2047) {
+            bits_.Write(0b1110, 4);
+            bits_.Write(static_cast<uint64_t>(dod), 12);
+        } else {
+            bits_.Write(0b1111, 4);
+            bits_.Write(static_cast<uint64_t>(dod), 64);
+        }
+        lastDelta_ = delta;
+        lastTimestamp_ = timestamp;
+    }
+
+    void WriteValue(double value) {
+        uint64_t valueBits = ToBits(value);
+        uint64_t x = valueBits ^ lastValueBits_;
+        lastValueBits_ = valueBits;
+        if (x == 0) {
+            bits_.Write(0b0, 1);
+            return;
+        }
+        int leading = __builtin_clzll(x);
+        int trailing = __builtin_ctzll(x);
+        if (leading > 31) leading = 31; // Поле ведущих нулей занимает 5 бит
+        if (prevLeading_ >= 0 && leading >= prevLeading_ && trailing >= prevTrailing_) {
+            // Значимые биты помещаются в предыдущее окно
+            bits_.Write(0b10, 2);
+            bits_.Write(x >> prevTrailing_, 64 - prevLeading_ - prevTrailing_);
+        } else {
+            int meaningful = 64 - leading - trailing;
+            bits_.Write(0b11, 2);
+            bits_.Write(static_cast<uint64_t>(leading), 5);
+            bits_.Write(static_cast<uint64_t>(meaningful & 63), 6); // 64 кодируется как 0
+            bits_.Write(x >> trailing, meaningful);
+            prevLeading_ = leading;
+            prevTrailing_ = trailing;
+        }
+    }
+
+public:
+    void Append(int64_t timestamp, double value) {
+        if (count_ == 0) {
+            firstTimestamp_ = lastTimestamp_ = timestamp;
+            lastDelta_ = 0;
+            lastValueBits_ = ToBits(value);
+            prevLeading_ = -1;
+            prevTrailing_ = 0;
+            bits_.Write(static_cast<uint64_t>(timestamp), 64);
+            bits_.Write(lastValueBits_, 64);
+        } else {
+            WriteTimestamp(timestamp);
+            WriteValue(value);
+        }
+        ++count_;
+    }
+
+    // Декодирует все точки блока по порядку
+    void ForEach(const std::function<void(int64_t, double)>& visit) const {
+        if (count_ == 0) return;
+        BitReader reader(bits_.GetWords());
+        int64_t timestamp = static_cast<int64_t>(reader.Read(64));
+        uint64_t valueBits = reader.Read(64);
+        int64_t delta = 0;
+        int leading = 0, trailing = 0;
+        visit(timestamp, FromBits(valueBits));
+        for (size_t i = 1; i < count_; ++i) {
+            // Метка времени
+            int64_t dod;
+            if (!reader.ReadBit()) dod = 0;
+            else if (!reader.ReadBit()) dod = SignExtend(reader.Read(7), 7);
+            else if (!reader.ReadBit()) dod = SignExtend(reader.Read(9), 9);
+            else if (!reader.ReadBit()) dod = SignExtend(reader.Read(12), 12);
+            else dod = static_cast<int64_t>(reader.Read(64));
+            delta += dod;
+            timestamp += delta;
+            // Значение
+            if (reader.ReadBit()) {
+                if (reader.ReadBit()) {
+                    leading = static_cast<int>(reader.Read(5));
+                    int meaningful = static_cast<int>(reader.Read(6));
+                    if (meaningful == 0) meaningful = 64;
+                    trailing = 64 - leading - meaningful;
+                }
+                valueBits ^= reader.Read(64 - leading - trailing) << trailing;
+            }
+            visit(timestamp, FromBits(valueBits));
+        }
+    }
+
+    void Clear() {
+        bits_.Clear();
+        count_ = 0;
+    }
+
+    size_t GetCount() const { return count_; }
+    int64_t GetFirstTimestamp() const { return firstTimestamp_; }
+    int64_t GetLastTimestamp() const { return lastTimestamp_; }
+    size_t GetEncodedBytes() const { return (bits_.GetBitCount() + 7) / 8; }
+    size_t GetCapacityBytes() const { return bits_.GetCapacityBytes(); }
+};
+
+// === 3. Агрегат окна (Rollup) ===
+struct RollupBucket {
+    int64_t start = std::numeric_limits<int64_t>::min();
+    double min = 0.0;
+    double max = 0.0;
+    double sum = 0.0;
+    uint32_t count = 0;
+
+    double Avg() const { return count ? sum / count : 0.0; }
+};
+
+class RollupRing {
+private:
+    int64_t resolution_;
+    std::vector<RollupBucket> buckets_;
+
+    static int64_t FloorDiv(int64_t a, int64_t b) {
+        int64_t q = a / b;
+        return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+    }
+
+public:
+    RollupRing(int64_t resolution, size_t bucketCount) : resolution_(resolution), buckets_(bucketCount) {}
+
+    void Add(int64_t timestamp, double value) {
+        int64_t index = FloorDiv(timestamp, resolution_);
+        RollupBucket& bucket = buckets_[static_cast<size_t>(index) % buckets_.size()];
+        int64_t start = index * resolution_;
+        if (bucket.start != start) {
+            bucket.start = start;
+            bucket.min = bucket.max = bucket.sum = value;
+            bucket.count = 1;
+            return;
+        }
+        if (value < bucket.min) bucket.min = value;
+        if (value > bucket.max) bucket.max = value;
+        bucket.sum += value;
+        ++bucket.count;
+    }
+
+    // Агрегат окна, содержащего timestamp, за O(1); nullptr, если окно вытеснено
+    const RollupBucket* Find(int64_t timestamp) const {
+        int64_t index = FloorDiv(timestamp, resolution_);
+        const RollupBucket& bucket = buckets_[static_cast<size_t>(index) % buckets_.size()];
+        return bucket.start == index * resolution_ ? &bucket : nullptr;
+    }
+
+    int64_t GetResolution() const { return resolution_; }
+    size_t GetMemoryBytes() const { return buckets_.size() * sizeof(RollupBucket); }
+};
+
+// === 4. Временной ряд одного датчика ===
+class SensorTimeSeries {
+private:
+    size_t pointsPerBlock_;
+    std::vector<CompressedBlock> blocks_; // Кольцо блоков для ограничения хранения
+    size_t headBlock_ = 0;                // Самый старый блок
+    size_t usedBlocks_ = 0;
+    std::vector<RollupRing> rollups_;
+    int64_t lastTimestamp_ = std::numeric_limits<int64_t>::min();
+
+    CompressedBlock& CurrentBlock() { return blocks_[(headBlock_ + usedBlocks_ - 1) % blocks_.size()]; }
+
+public:
+    // resolutions — длительности окон агрегации (в единицах меток времени)
+    SensorTimeSeries(size_t pointsPerBlock, size_t maxBlocks,
+                     const std::vector<int64_t>& resolutions, size_t bucketsPerResolution)
+        : pointsPerBlock_(pointsPerBlock), blocks_(maxBlocks) {
+        for (int64_t resolution : resolutions) {
+            rollups_.emplace_back(resolution, bucketsPerResolution);
+        }
+    }
+
+    // Добавляет точку; метки времени должны неубывать
+    void Append(int64_t timestamp, double value) {
+        if (usedBlocks_ == 0 || CurrentBlock().GetCount() >= pointsPerBlock_) {
+            if (usedBlocks_ == blocks_.size()) {
+                // Вытесняем самый старый блок, переиспользуя его память
+                blocks_[headBlock_].Clear();
+                headBlock_ = (headBlock_ + 1) % blocks_.size();
+                --usedBlocks_;
+            }
+            ++usedBlocks_;
+            CurrentBlock().Clear();
+        }
+        CurrentBlock().Append(timestamp, value);
+        for (auto& rollup : rollups_) rollup.Add(timestamp, value);
+        lastTimestamp_ = timestamp;
+    }
+
+    // Агрегат окна заданного разрешения, содержащего timestamp, за O(1)
+    const RollupBucket* GetWindow(size_t resolutionIndex, int64_t timestamp) const {
+        return rollups_[resolutionIndex].Find(timestamp);
+    }
+
+    // Агрегат текущего (последнего) окна заданного разрешения
+    const RollupBucket* GetLatestWindow(size_t resolutionIndex) const {
+        if (usedBlocks_ == 0) return nullptr;
+        return rollups_[resolutionIndex].Find(lastTimestamp_);
+    }
+
+    // Сырые точки из [from, to], декодированные из сжатых блоков
+    void Scan(int64_t from, int64_t to, const std::function<void(int64_t, double)>& visit) const {
+        for (size_t i = 0; i < usedBlocks_; ++i) {
+            const CompressedBlock& block = blocks_[(headBlock_ + i) % blocks_.size()];
+            if (block.GetLastTimestamp() < from || block.GetFirstTimestamp() > to) continue;
+            block.ForEach([&](int64_t ts, double value) {
+                if (ts >= from && ts <= to) visit(ts, value);
+            });
+        }
+    }
+
+    size_t GetPointCount() const {
+        size_t total = 0;
+        for (size_t i = 0; i < usedBlocks_; ++i) total += blocks_[(headBlock_ + i) % blocks_.size()].GetCount();
+        return total;
+    }
+
+    size_t GetEncodedBytes() const {
+        size_t total = 0;
+        for (size_t i = 0; i < usedBlocks_; ++i) total += blocks_[(headBlock_ + i) % blocks_.size()].GetEncodedBytes();
+        return total;
+    }
+
+    size_t GetMemoryBytes() const {
+        size_t total = sizeof(*this) + blocks_.size() * sizeof(CompressedBlock);
+        for (const auto& block : blocks_) total += block.GetCapacityBytes();
+        for (const auto& rollup : rollups_) total += rollup.GetMemoryBytes();
+        return total;
+    }
+};
+
+// === 5. Клиент с историей показаний ===
+// Сохраняет показание в ряд и принимает решение о кондиционере по среднему
+// значению текущего окна (индекс разрешения windowIndex), а не по одному замеру.
+void ClientCode(const ITargetSensor& sensor, SensorTimeSeries& history, int64_t timestamp, size_t windowIndex) {
+    double tempC = sensor.GetTemperatureCelsius();
+    history.Append(timestamp, tempC);
+
+    const RollupBucket* window = history.GetLatestWindow(windowIndex);
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "[Client] Received temperature: " << tempC << " °C, window avg: " << window->Avg()
+              << " °C (min " << window->min << ", max " << window->max << ")." << std::endl;
+    if (window->Avg() > 24.0) {
+        std::cout << "[Client] Output: AC required." << std::endl;
+    } else {
+        std::cout << "[Client] Output: Comfortable temperature." << std::endl;
+    }
+}
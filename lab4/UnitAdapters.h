@@ -0,0 +1,140 @@
+#pragma once
+#include "AdapterSystem.h"
+#include <cstdint>
+#include <type_traits>
+
+// === Адаптеры единиц измерения времени компиляции ===
+// Исходная и целевая единицы — параметры шаблона. Каждая единица описывается
+// линейным отображением в Цельсии (C = value * kScale + kOffset), поэтому
+// преобразование Source -> Target сворачивается компилятором в одну пару
+// констант и выполняется одним умножением-сложением (FMA при -mfma).
+
+// === 1. Единицы измерения ===
+struct Celsius {
+    static constexpr double kScale = 1.0;
+    static constexpr double kOffset = 0.0;
+    static constexpr const char* kSymbol = "°C";
+};
+
+struct Fahrenheit {
+    static constexpr double kScale = 5.0 / 9.0;
+    static constexpr double kOffset = -32.0 * 5.0 / 9.0;
+    static constexpr const char* kSymbol = "°F";
+};
+
+struct Kelvin {
+    static constexpr double kScale = 1.0;
+    static constexpr double kOffset = -273.15;
+    static constexpr const char* kSymbol = "K";
+};
+
+// Сырые отсчеты АЦП разрядности Bits, покрывающие диапазон [MinC, MaxC] °C
+template <unsigned Bits, int MinC, int MaxC>
+struct AdcCounts {
+    static constexpr double kScale = static_cast<double>(MaxC - MinC) / ((1u << Bits) - 1);
+    static constexpr double kOffset = static_cast<double>(MinC);
+    static constexpr const char* kSymbol = "counts";
+};
+
+// Типичный 12-битный датчик с диапазоном -40..125 °C
+using Adc12Counts = AdcCounts<12, -40, 125>;
+
+// === 2. Преобразование Source -> Target ===
+template <typename Source, typename Target>
+struct UnitConversion {
+    // target = (value * S.scale + S.offset - T.offset) / T.scale
+    static constexpr double kScale = Source::kScale / Target::kScale;
+    static constexpr double kOffset = (Source::kOffset - Target::kOffset) / Target::kScale;
+
+    static constexpr double Apply(double value) { return value * kScale + kOffset; }
+};
+
+// === 3. Дополнительные устаревшие датчики (Adaptee) ===
+class LegacyKelvinSensor {
+public:
+    double GetTemperatureKelvin() const { return 298.15; }
+};
+
+// Имитирует АЦП: отсчеты медленно пробегают диапазон при каждом чтении
+class LegacyAdcSensor {
+private:
+    mutable uint16_t counts_ = 1800;
+
+public:
+    uint16_t ReadRawCounts() const {
+        counts_ = static_cast<uint16_t>((counts_ + 1) & 0x0FFF);
+        return counts_;
+    }
+};
+
+// Способ чтения "сырого" значения у каждого Adaptee
+template <typename Adaptee>
+struct AdapteeReader;
+
+template <>
+struct AdapteeReader<LegacyFahrenheitSensor> {
+    static double Read(const LegacyFahrenheitSensor& sensor) { return sensor.GetTemperatureFahrenheit(); }
+};
+
+template <>
+struct AdapteeReader<LegacyKelvinSensor> {
+    static double Read(const LegacyKelvinSensor& sensor) { return sensor.GetTemperatureKelvin(); }
+};
+
+template <>
+struct AdapteeReader<LegacyAdcSensor> {
+    static double Read(const LegacyAdcSensor& sensor) { return sensor.ReadRawCounts(); }
+};
+
+// === 4. Статический адаптер (без виртуального вызова) ===
+template <typename Adaptee, typename SourceUnit, typename TargetUnit = Celsius>
+class UnitAdapter {
+private:
+    Adaptee adaptee_;
+
+public:
+    using Target = TargetUnit;
+
+    double GetTemperature() const {
+        return UnitConversion<SourceUnit, TargetUnit>::Apply(AdapteeReader<Adaptee>::Read(adaptee_));
+    }
+};
+
+using FahrenheitAdapter = UnitAdapter<LegacyFahrenheitSensor, Fahrenheit>;
+using KelvinAdapter = UnitAdapter<LegacyKelvinSensor, Kelvin>;
+using AdcAdapter = UnitAdapter<LegacyAdcSensor, Adc12Counts>;
+
+// === 5. Адаптер времени выполнения (для сравнения) ===
+// Тот же набор единиц, но коэффициенты хранятся в объекте, а вызов идет
+// через виртуальный ITargetSensor, как у SensorAdapter.
+template <typename Adaptee>
+class RuntimeUnitAdapter : public ITargetSensor {
+private:
+    Adaptee adaptee_;
+    double scale_;
+    double offset_;
+
+public:
+    RuntimeUnitAdapter(double sourceScale, double sourceOffset)
+        : scale_(sourceScale), offset_(sourceOffset) {}
+
+    double GetTemperatureCelsius() const override {
+        return AdapteeReader<Adaptee>::Read(adaptee_) * scale_ + offset_;
+    }
+};
+
+// === 6. Клиент со статической диспетчеризацией ===
+// Принимает любой статический адаптер с целевой единицей Celsius
+template <typename Sensor, typename = std::enable_if_t<std::is_same<typename Sensor::Target, Celsius>::value>>
+void ClientCode(const Sensor& sensor) {
+    std::cout << "\n[Client] Requesting temperature (static dispatch, expecting °C)..." << std::endl;
+    double tempC = sensor.GetTemperature();
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "[Client] Received temperature: " << tempC << " °C." << std::endl;
+    if (tempC > 24.0) {
+        std::cout << "[Client] Output: AC required." << std::endl;
+    } else {
+        std::cout << "[Client] Output: Comfortable temperature." << std::endl;
+    }
+}
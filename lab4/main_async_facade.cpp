@@ -0,0 +1,46 @@
+#include "AsyncFacade.h"
+
+int main() {
+    std::cout << "--- Tourist Agency System (Async Facade) ---" << std::endl;
+
+    // Имитация задержек подсистем: поиск медленнее подтверждения
+    TourStepProfile profile;
+    profile.latency = {std::chrono::milliseconds(40), std::chrono::milliseconds(20),   // Авиабилеты
+                       std::chrono::milliseconds(50), std::chrono::milliseconds(25),   // Отель
+                       std::chrono::milliseconds(30), std::chrono::milliseconds(15)};  // Питание
+
+    // Сценарий 1: успешное бронирование, ветви выполняются параллельно
+    AsyncTourismFacade agency(profile);
+    PrintBooking("Dubai", agency.OrganizeTour("Dubai", 5, "All Inclusive"));
+
+    // Сценарий 2: оплата питания отклонена -> отмена билета и номера
+    TourStepProfile failing = profile;
+    failing.fail[static_cast<size_t>(TourStep::PayForMealPlan)] = true;
+    PrintBooking("Sochi", AsyncTourismFacade(failing).OrganizeTour("Sochi", 3, "Half Board"));
+
+    // Сценарий 3: поиск отеля не укладывается в таймаут
+    TourStepProfile slow = profile;
+    slow.latency[static_cast<size_t>(TourStep::FindHotel)] = std::chrono::milliseconds(300);
+    slow.timeout[static_cast<size_t>(TourStep::FindHotel)] = std::chrono::milliseconds(100);
+    PrintBooking("Kazan", AsyncTourismFacade(slow).OrganizeTour("Kazan", 4, "Breakfast"));
+
+    // Сценарий 4: подтверждение номера не укладывается в таймаут, но проходит позже —
+    // фасад дожидается его и отменяет вместе с остальными бронированиями
+    TourStepProfile lateCommit = profile;
+    lateCommit.latency[static_cast<size_t>(TourStep::ReserveRoom)] = std::chrono::milliseconds(200);
+    lateCommit.timeout[static_cast<size_t>(TourStep::ReserveRoom)] = std::chrono::milliseconds(50);
+    PrintBooking("Omsk", AsyncTourismFacade(lateCommit).OrganizeTour("Omsk", 3, "Breakfast"));
+
+    // Сравнение сквозной задержки с последовательным фасадом
+    const int rounds = 10;
+    double asyncMs = 0.0, sequentialMs = 0.0;
+    for (int i = 0; i < rounds; ++i) {
+        asyncMs += agency.OrganizeTour("Dubai", 5, "All Inclusive").elapsed.count() / 1000.0;
+        sequentialMs += agency.OrganizeTourSequential("Dubai", 5, "All Inclusive").elapsed.count() / 1000.0;
+    }
+    std::cout << "\n--- End-to-end booking latency (" << rounds << " tours) ---" << std::endl;
+    std::cout << "[Bench] Sequential facade: " << sequentialMs / rounds << " ms/tour" << std::endl;
+    std::cout << "[Bench] Async facade:      " << asyncMs / rounds << " ms/tour" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include "FacadeSystem.h"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+// Параметры: [число туров] [число городов]
+int main(int argc, char* argv[]) {
+    std::cout << "--- Tourist Agency System (Batch Facade) ---" << std::endl;
+
+    TourismFacade travelAgency;
+
+    // 1. Пакет из нескольких запросов: Dubai запрошен дважды и ищется один раз
+    std::vector<TourRequest> demo = {
+        {"Dubai", 5, "All Inclusive"}, {"Sochi", 3, "Half Board"}, {"Dubai", 5, "All Inclusive"}};
+    travelAgency.OrganizeTours(demo);
+
+    // 2. Пакетный вывод совпадает с последовательными вызовами OrganizeTour
+    std::ostringstream single, batch;
+    std::streambuf* original = std::cout.rdbuf(single.rdbuf());
+    for (const TourRequest& request : demo) travelAgency.OrganizeTour(request.city, request.stars, request.mealPlan);
+    std::cout.rdbuf(original);
+    travelAgency.OrganizeTours(demo, batch);
+    std::cout << "\n[Batch] Output identical to OrganizeTour: " << (single.str() == batch.str() ? "yes" : "no") << std::endl;
+
+    // 3. Поток туров с повторяющимися направлениями
+    size_t tourCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000;
+    size_t cityCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 50;
+    const char* mealPlans[] = {"All Inclusive", "Half Board", "Breakfast"};
+    std::mt19937 rng(7);
+    std::vector<TourRequest> requests;
+    requests.reserve(tourCount);
+    for (size_t i = 0; i < tourCount; ++i) {
+        requests.push_back({"City-" + std::to_string(rng() % cityCount), 3 + static_cast<int>(rng() % 3), mealPlans[rng() % 3]});
+    }
+
+    // Вывод в /dev/null: измеряется стоимость форматирования и системных вызовов
+    std::ofstream devNull("/dev/null");
+    auto measure = [&](auto func) {
+        auto start = std::chrono::steady_clock::now();
+        func();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    original = std::cout.rdbuf(devNull.rdbuf());
+    double singleSeconds = measure([&] {
+        for (const TourRequest& request : requests) travelAgency.OrganizeTour(request.city, request.stars, request.mealPlan);
+    });
+    std::cout.rdbuf(original);
+    double batchSeconds = measure([&] { travelAgency.OrganizeTours(requests, devNull); });
+
+    std::cout << "\n--- Throughput (" << tourCount << " tours, " << cityCount << " cities) ---" << std::endl;
+    std::cout << "[Bench] OrganizeTour per request: " << static_cast<size_t>(tourCount / singleSeconds) << " tours/s" << std::endl;
+    std::cout << "[Bench] OrganizeTours batch:      " << static_cast<size_t>(tourCount / batchSeconds) << " tours/s" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include "FacadeCache.h"
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <thread>
+
+// Распределение Ципфа: небольшое число популярных городов получает большую часть запросов
+class ZipfGenerator {
+private:
+    std::vector<double> cdf_;
+
+public:
+    ZipfGenerator(size_t n, double s) : cdf_(n) {
+        double sum = 0.0;
+        for (size_t i = 0; i < n; ++i) cdf_[i] = (sum += 1.0 / std::pow(static_cast<double>(i + 1), s));
+        for (double& value : cdf_) value /= sum;
+    }
+
+    template <typename Rng>
+    size_t operator()(Rng& rng) {
+        double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+        return std::lower_bound(cdf_.begin(), cdf_.end(), u) - cdf_.begin();
+    }
+};
+
+void PrintCounters(const char* name, const CacheCounters& counters) {
+    std::cout << "[Cache] " << name << ": hits " << counters.hits << ", misses " << counters.misses
+              << ", evictions " << counters.evictions << ", expirations " << counters.expirations
+              << ", hit rate " << counters.HitRate() * 100.0 << "%, avg lookup "
+              << counters.AvgLookupNanos() << " ns" << std::endl;
+}
+
+// Имитация стоимости поиска в подсистеме для прямых вызовов
+void SpinFor(std::chrono::nanoseconds cost) {
+    auto until = std::chrono::steady_clock::now() + cost;
+    while (std::chrono::steady_clock::now() < until) {
+    }
+}
+
+// Параметры: [число потоков] [запросов на поток] [число городов] [стоимость поиска, нс]
+int main(int argc, char* argv[]) {
+    std::cout << "--- Tourist Agency System (Cached Facade) ---" << std::endl;
+
+    CachedTourismFacade agency;
+    agency.OrganizeTour("Dubai", 5, "All Inclusive");
+    agency.OrganizeTour("Dubai", 5, "All Inclusive"); // Повторный поиск берется из кэша
+
+    size_t threadCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4;
+    size_t requestsPerThread = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 500000;
+    size_t cityCount = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 10000;
+    std::chrono::nanoseconds backendCost(argc > 4 ? std::strtol(argv[4], nullptr, 10) : 2000);
+
+    std::vector<std::string> cities;
+    for (size_t i = 0; i < cityCount; ++i) cities.push_back("City-" + std::to_string(i));
+
+    // Кэш вмещает лишь часть городов: популярные остаются, редкие вытесняются
+    CachedTourismFacade cached(16, cityCount / 4, std::chrono::seconds(30), backendCost);
+    HotelBookingSystem hotelSystem;
+    FlightBookingSystem flightSystem;
+
+    auto run = [&](bool useCache) {
+        std::vector<std::thread> threads;
+        std::atomic<size_t> checksum{0};
+        auto start = std::chrono::steady_clock::now();
+        for (size_t t = 0; t < threadCount; ++t) {
+            threads.emplace_back([&, t] {
+                std::mt19937_64 rng(42 + t);
+                ZipfGenerator zipf(cityCount, 1.1);
+                size_t local = 0;
+                for (size_t i = 0; i < requestsPerThread; ++i) {
+                    const std::string& city = cities[zipf(rng)];
+                    int stars = 3 + static_cast<int>(i % 3);
+                    if (useCache) {
+                        local += cached.FindTickets(city)->size() + cached.FindHotel(city, stars)->size();
+                    } else {
+                        SpinFor(backendCost);
+                        SpinFor(backendCost);
+                        local += flightSystem.FindTickets(city).size() + hotelSystem.FindHotel(city, stars).size();
+                    }
+                }
+                checksum += local;
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return std::make_pair(seconds, checksum.load());
+    };
+
+    auto direct = run(false);
+    auto withCache = run(true);
+    size_t lookups = threadCount * requestsPerThread * 2;
+
+    std::cout << "\n--- Skewed lookup benchmark (" << threadCount << " threads, " << cityCount << " cities, Zipf s=1.1, lookup cost "
+              << backendCost.count() << " ns) ---" << std::endl;
+    std::cout << "[Bench] Direct subsystem calls: " << direct.first * 1e9 / lookups << " ns/lookup" << std::endl;
+    std::cout << "[Bench] Cached facade lookups:  " << withCache.first * 1e9 / lookups << " ns/lookup" << std::endl;
+    std::cout << "[Bench] Checksums match: " << (direct.second == withCache.second ? "yes" : "no") << std::endl;
+    PrintCounters("FindTickets", cached.GetTicketCounters());
+    PrintCounters("FindHotel", cached.GetHotelCounters());
+
+    // Поток только из разных городов: память ограничена емкостью кэша
+    CachedTourismFacade bounded(16, 1024, std::chrono::seconds(30));
+    size_t distinct = 200000;
+    for (size_t i = 0; i < distinct; ++i) bounded.FindTickets("Unique-City-" + std::to_string(i));
+    std::cout << "[Cache] " << distinct << " distinct cities through a 1024-entry cache: " << bounded.GetCachedEntries()
+              << " entries resident" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,53 @@
+#include "SensorPolling.h"
+#include <cstdlib>
+
+// Параметры: [число датчиков] [задержка чтения, мкс] [длительность, мс]
+int main(int argc, char* argv[]) {
+    std::cout << "--- Smart Home System (Async Sensor Polling) ---" << std::endl;
+
+    size_t sensorCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 64;
+    long latencyUs = argc > 2 ? std::strtol(argv[2], nullptr, 10) : 2000;
+    long durationMs = argc > 3 ? std::strtol(argv[3], nullptr, 10) : 2000;
+
+    // 1. Создаем датчики с имитацией медленного ввода-вывода
+    std::vector<std::unique_ptr<SimulatedLatencySensor>> sensors;
+    for (size_t i = 0; i < sensorCount; ++i) {
+        sensors.push_back(std::make_unique<SimulatedLatencySensor>(
+            70.0 + static_cast<double>(i % 20), std::chrono::microseconds(latencyUs)));
+    }
+
+    // 2. Планировщик: тик 1 мс, 512 ячеек колеса, 8 рабочих потоков
+    SensorPoller poller(std::chrono::microseconds(1000), 512, 8, 1 << 16);
+    for (size_t i = 0; i < sensorCount; ++i) {
+        // Разные частоты опроса: 10, 20, 50 и 100 мс
+        static const int periodsMs[] = {10, 20, 50, 100};
+        poller.AddSensor(sensors[i].get(), std::chrono::milliseconds(periodsMs[i % 4]));
+    }
+
+    // 3. Потребитель забирает результаты из lock-free буфера
+    LatencyStats stats;
+    SensorReading reading;
+    double lastCelsius = 0.0;
+    poller.Start();
+    PollClock::time_point deadline = PollClock::now() + std::chrono::milliseconds(durationMs);
+    while (PollClock::now() < deadline) {
+        while (poller.TryConsume(reading)) {
+            stats.Add(reading);
+            lastCelsius = reading.celsius;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+    }
+    poller.Stop();
+    while (poller.TryConsume(reading)) stats.Add(reading);
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "[Poller] Sensors: " << sensorCount << ", read latency: " << latencyUs << " us" << std::endl;
+    std::cout << "[Poller] Delivered: " << stats.Count()
+              << ", skipped (busy): " << poller.GetSkipped()
+              << ", dropped (ring full): " << poller.GetDropped() << std::endl;
+    std::cout << "[Poller] Delivery latency p50: " << stats.Percentile(0.50) << " us" << std::endl;
+    std::cout << "[Poller] Delivery latency p99: " << stats.Percentile(0.99) << " us" << std::endl;
+    std::cout << "[Poller] Last reading: " << lastCelsius << " °C" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include "SensorTimeSeries.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+// Датчик для демонстрации: возвращает заданную последовательность показаний
+class ScriptedSensor : public ITargetSensor {
+private:
+    std::vector<double> readings_;
+    mutable size_t next_ = 0;
+
+public:
+    explicit ScriptedSensor(std::vector<double> readings) : readings_(std::move(readings)) {}
+    double GetTemperatureCelsius() const override { return readings_[next_++ % readings_.size()]; }
+};
+
+int main(int argc, char* argv[]) {
+    std::cout << "--- Smart Home System (Sensor Time-Series Store) ---" << std::endl;
+
+    // Разрешения агрегатов: 1 с, 1 мин, 1 ч (метки времени в мс)
+    const std::vector<int64_t> resolutions = {1000, 60 * 1000, 60 * 60 * 1000};
+
+    // 1. Решение о кондиционере по окну в 1 минуту, а не по одному замеру
+    std::cout << "\n--- Windowed AC decision ---" << std::endl;
+    SensorTimeSeries history(1024, 16, resolutions, 64);
+    ScriptedSensor sensor({23.0, 23.5, 26.0, 23.2, 23.1});
+    for (int i = 0; i < 5; ++i) {
+        ClientCode(sensor, history, i * 10 * 1000, 1);
+    }
+
+    // 2. Замер скорости записи и объема памяти на точку
+    size_t pointCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+    std::cout << "\n--- Ingest benchmark (" << pointCount << " points) ---" << std::endl;
+    SensorTimeSeries series(4096, (pointCount + 4095) / 4096, resolutions, 4096);
+
+    std::vector<double> values(pointCount);
+    for (size_t i = 0; i < pointCount; ++i) {
+        // Медленно меняющаяся температура с шагом датчика 0.1 °C
+        values[i] = std::round((22.0 + 3.0 * std::sin(i * 1e-4)) * 10.0) / 10.0;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    int64_t timestamp = 1700000000000;
+    for (size_t i = 0; i < pointCount; ++i) {
+        // Период 1 с с редким дрожанием
+        timestamp += 1000 + ((i % 97) == 0 ? 3 : 0);
+        series.Append(timestamp, values[i]);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Проверка: декодированные значения совпадают с записанными
+    size_t checked = 0;
+    bool ok = true;
+    series.Scan(std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max(),
+                [&](int64_t, double value) { ok = ok && value == values[checked++]; });
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "[TSDB] Ingest rate: " << pointCount / seconds / 1e6 << " M points/s" << std::endl;
+    std::cout << "[TSDB] Encoded bytes per point: " << static_cast<double>(series.GetEncodedBytes()) / pointCount
+              << " (raw: 16.00)" << std::endl;
+    std::cout << "[TSDB] Memory bytes per point: " << static_cast<double>(series.GetMemoryBytes()) / pointCount << std::endl;
+    std::cout << "[TSDB] Round-trip check: " << (ok && checked == pointCount ? "OK" : "FAILED") << std::endl;
+
+    const RollupBucket* hour = series.GetLatestWindow(2);
+    std::cout << "[TSDB] Last hour: min " << hour->min << ", max " << hour->max << ", avg " << hour->Avg()
+              << " (" << hour->count << " points)" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include "UnitAdapters.h"
+#include <chrono>
+#include <cstdlib>
+
+// Проверка во время компиляции: коэффициенты свернуты в константы
+static_assert(UnitConversion<Kelvin, Celsius>::Apply(273.15) == 0.0, "K -> C");
+static_assert(UnitConversion<Celsius, Fahrenheit>::Apply(100.0) > 211.99 &&
+              UnitConversion<Celsius, Fahrenheit>::Apply(100.0) < 212.01, "C -> F");
+
+// Чтение через виртуальный интерфейс; noinline исключает девиртуализацию
+__attribute__((noinline)) double SumRuntime(const ITargetSensor& sensor, size_t reads) {
+    double sum = 0.0;
+    for (size_t i = 0; i < reads; ++i) sum += sensor.GetTemperatureCelsius();
+    return sum;
+}
+
+template <typename Sensor>
+__attribute__((noinline)) double SumStatic(const Sensor& sensor, size_t reads) {
+    double sum = 0.0;
+    for (size_t i = 0; i < reads; ++i) sum += sensor.GetTemperature();
+    return sum;
+}
+
+template <typename Func>
+double MeasureNs(Func func, size_t reads, double& result) {
+    auto start = std::chrono::steady_clock::now();
+    result = func();
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / reads;
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "--- Smart Home System (Compile-Time Unit Adapters) ---" << std::endl;
+
+    // 1. Клиент работает со статическими адаптерами разных единиц
+    FahrenheitAdapter fahrenheit;
+    KelvinAdapter kelvin;
+    AdcAdapter adc;
+    ClientCode(fahrenheit);
+    ClientCode(kelvin);
+    ClientCode(adc);
+
+    // 2. Исходный адаптер по-прежнему идет через виртуальный интерфейс
+    SensorAdapter legacy;
+    ClientCode(legacy);
+
+    // 3. Сравнение статического и виртуального адаптеров на потоке отсчетов АЦП
+    size_t reads = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000000;
+    RuntimeUnitAdapter<LegacyAdcSensor> runtimeAdc(Adc12Counts::kScale, Adc12Counts::kOffset);
+    AdcAdapter staticAdc;
+
+    double runtimeSum = 0.0, staticSum = 0.0;
+    double runtimeNs = MeasureNs([&] { return SumRuntime(runtimeAdc, reads); }, reads, runtimeSum);
+    double staticNs = MeasureNs([&] { return SumStatic(staticAdc, reads); }, reads, staticSum);
+
+    std::cout << "\n--- Benchmark (" << reads << " reads) ---" << std::endl;
+    std::cout << std::setprecision(3);
+    std::cout << "[Bench] Runtime adapter (virtual): " << runtimeNs << " ns/read" << std::endl;
+    std::cout << "[Bench] Static adapter (template): " << staticNs << " ns/read" << std::endl;
+    std::cout << "[Bench] Speedup: " << runtimeNs / staticNs << "x" << std::endl;
+    std::cout << "[Bench] Checksums: " << runtimeSum << " / " << staticSum << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,430 @@
+#pragma once
+#include "ElevatorFSM.h"
+#include "Histogram.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <random>
+#include <set>
+#include <vector>
+
+// === Симулятор группы лифтов (Elevator Bank) ===
+// Несколько кабин в одном здании, дискретно-событийное время, время проезда
+// этажа и работы дверей. Каждая кабина ведет собственный TableElevator
+// (Standing/Moving/Overloaded/...), а распределение вызовов между кабинами
+// выполняет подключаемая стратегия диспетчеризации (паттерн Стратегия).
+
+// === 1. Параметры здания и пассажиры ===
+struct BankConfig {
+    int floors = 20;
+    size_t cars = 4;
+    size_t carCapacity = 12;
+    double floorTravelTime = 1.5; // с на этаж
+    double doorTime = 4.0;        // Открытие + закрытие дверей, с
+    double boardTime = 1.0;       // Вход или выход одного пассажира, с
+};
+
+struct Passenger {
+    double arrivalTime;
+    int origin;
+    int destination;
+    double pickupTime = 0.0;
+};
+
+// Направление: -1 вниз, 0 стоит без задач, +1 вверх
+inline int DirectionOf(int from, int to) { return to > from ? 1 : (to < from ? -1 : 0); }
+
+// === 2. Кабина ===
+struct ElevatorCar {
+    TableElevator fsm{ElevatorStateId::Standing, false}; // Состояние кабины
+    int position = 1;
+    int direction = 0;
+    bool busy = false;      // Запланировано событие кабины (шаг или закрытие дверей)
+    std::set<int> stops;    // Этажи, где нужно остановиться
+    std::vector<Passenger> riders;
+
+    bool HasStopsAhead(int dir) const {
+        if (dir > 0) return stops.upper_bound(position) != stops.end();
+        if (dir < 0) return stops.lower_bound(position) != stops.begin();
+        return false;
+    }
+
+    bool IsInService() const {
+        ElevatorStateId state = fsm.GetState();
+        return state == ElevatorStateId::Standing || state == ElevatorStateId::Moving;
+    }
+};
+
+// Вызов с этажа (направление известно; для destination dispatch — и этаж назначения)
+struct HallCall {
+    int floor;
+    int direction;
+    int destination;
+};
+
+class ElevatorBank;
+
+// === 3. Стратегии диспетчеризации ===
+class IDispatchPolicy {
+public:
+    virtual ~IDispatchPolicy() = default;
+    virtual std::string GetName() const = 0;
+    // Возвращает индекс кабины, которой назначается вызов, или kNoCar, если
+    // исправных кабин нет (вызов остается в очереди этажа)
+    virtual size_t AssignCar(const ElevatorBank& bank, const HallCall& call) = 0;
+
+    static constexpr size_t kNoCar = std::numeric_limits<size_t>::max();
+};
+
+// === 4. Группа лифтов ===
+class ElevatorBank {
+public:
+    // Недоставленные к моменту снимка пассажиры (ждут на этаже или едут) входят в
+    // суммы и гистограммы цензурированными выборками — временем, прошедшим до
+    // снимка. Поэтому при перегрузке средние и квантили — оценки снизу, а не
+    // статистика одних доставленных, которая выглядит лучше реальной
+    struct Stats {
+        uint64_t passengersGenerated = 0;   // Появились на этажах
+        uint64_t passengersDelivered = 0;
+        uint64_t passengersUndelivered = 0; // Цензурированные выборки
+        uint64_t unassignedCalls = 0;       // Вызовы, для которых не нашлось исправной кабины
+        double totalWait = 0.0;
+        double totalTrip = 0.0;
+        double maxWait = 0.0;
+        uint64_t eventsProcessed = 0;
+        Histogram waitHistogram{1.0, 1800}; // Ожидание, с (корзины по 1 с)
+        Histogram tripHistogram{1.0, 1800}; // Ожидание + поездка, с
+
+        uint64_t Samples() const { return passengersDelivered + passengersUndelivered; }
+        double AvgWait() const { return Samples() ? totalWait / Samples() : 0.0; }
+        double AvgTrip() const { return Samples() ? totalTrip / Samples() : 0.0; }
+
+        void AddSample(double wait, double trip) {
+            totalWait += wait;
+            totalTrip += trip;
+            maxWait = std::max(maxWait, wait);
+            waitHistogram.Add(wait);
+            tripHistogram.Add(trip);
+        }
+    };
+
+private:
+    enum class EventType : uint8_t { PassengerArrival, CarStep, DoorsClosed };
+
+    struct Event {
+        double time;
+        uint64_t sequence; // Порядок для событий с одинаковым временем
+        EventType type;
+        size_t car;
+        Passenger passenger;
+
+        bool operator>(const Event& other) const {
+            return time != other.time ? time > other.time : sequence > other.sequence;
+        }
+    };
+
+    BankConfig config_;
+    std::vector<ElevatorCar> cars_;
+    IDispatchPolicy* policy_;
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> events_;
+    uint64_t sequence_ = 0;
+    double now_ = 0.0;
+
+    // Ожидающие пассажиры по этажам и направлениям; [0] — вниз, [1] — вверх
+    std::vector<std::deque<Passenger>> waiting_[2];
+    // Кабина, которой назначен вызов этажа, или kNoCar
+    std::vector<size_t> hallCallOwner_[2];
+    Stats stats_;
+
+    static size_t DirIndex(int dir) { return dir > 0 ? 1 : 0; }
+
+    void Schedule(double time, EventType type, size_t car, const Passenger& passenger = Passenger{}) {
+        events_.push({time, sequence_++, type, car, passenger});
+    }
+
+    void AddStop(size_t carIndex, int floor) {
+        ElevatorCar& car = cars_[carIndex];
+        car.stops.insert(floor);
+        if (!car.busy && car.IsInService()) {
+            // Кабина простаивает: начинаем движение или открываем двери на месте
+            car.busy = true;
+            if (floor == car.position) {
+                car.stops.erase(floor);
+                OpenDoors(carIndex);
+            } else {
+                car.direction = DirectionOf(car.position, floor);
+                car.fsm.Call(floor);
+                Schedule(now_ + config_.floorTravelTime, EventType::CarStep, carIndex);
+            }
+        }
+    }
+
+    void Dispatch(int floor, int dir) {
+        size_t& owner = hallCallOwner_[DirIndex(dir)][floor];
+        auto& queue = waiting_[DirIndex(dir)][floor];
+        if (owner != IDispatchPolicy::kNoCar || queue.empty()) return;
+        size_t carIndex = policy_->AssignCar(*this, {floor, dir, queue.front().destination});
+        if (carIndex == IDispatchPolicy::kNoCar) {
+            // Вызов не активен: его повторит следующий пассажир этажа или освободившаяся кабина
+            ++stats_.unassignedCalls;
+            return;
+        }
+        owner = carIndex;
+        AddStop(carIndex, floor);
+    }
+
+    // Остановка: высадка, посадка и планирование закрытия дверей
+    void OpenDoors(size_t carIndex) {
+        ElevatorCar& car = cars_[carIndex];
+        if (car.fsm.GetState() == ElevatorStateId::Moving) car.fsm.ChangeState(ElevatorStateId::Standing);
+        car.fsm.SetFloor(car.position);
+
+        size_t moved = 0;
+        auto arrived = std::partition(car.riders.begin(), car.riders.end(),
+                                      [&](const Passenger& p) { return p.destination != car.position; });
+        for (auto it = arrived; it != car.riders.end(); ++it) {
+            stats_.passengersDelivered++;
+            stats_.AddSample(it->pickupTime - it->arrivalTime, now_ - it->arrivalTime);
+            ++moved;
+        }
+        car.riders.erase(arrived, car.riders.end());
+
+        // Обслуживаемое направление: продолжаем текущее, если впереди есть работа
+        int serve = car.direction;
+        if (serve == 0 || (!car.HasStopsAhead(serve) && waiting_[DirIndex(serve)][car.position].empty())) {
+            serve = !waiting_[1][car.position].empty() ? 1 : (!waiting_[0][car.position].empty() ? -1 : serve);
+        }
+        if (serve != 0) {
+            hallCallOwner_[DirIndex(serve)][car.position] = IDispatchPolicy::kNoCar;
+            auto& queue = waiting_[DirIndex(serve)][car.position];
+            while (!queue.empty() && car.riders.size() < config_.carCapacity) {
+                Passenger p = queue.front();
+                queue.pop_front();
+                p.pickupTime = now_;
+                car.stops.insert(p.destination);
+                car.riders.push_back(p);
+                ++moved;
+            }
+            car.direction = serve;
+        }
+        Schedule(now_ + config_.doorTime + config_.boardTime * moved, EventType::DoorsClosed, carIndex);
+    }
+
+    void OnDoorsClosed(size_t carIndex) {
+        ElevatorCar& car = cars_[carIndex];
+        int floor = car.position;
+        // Оставшимся на этаже пассажирам нужен новый вызов
+        for (int dir : {1, -1}) {
+            if (!waiting_[DirIndex(dir)][floor].empty()) {
+                hallCallOwner_[DirIndex(dir)][floor] = IDispatchPolicy::kNoCar;
+            }
+        }
+        car.stops.erase(floor);
+
+        if (!car.HasStopsAhead(car.direction)) {
+            car.direction = car.HasStopsAhead(-car.direction) ? -car.direction : 0;
+            if (car.direction == 0 && !car.stops.empty()) car.direction = DirectionOf(floor, *car.stops.begin());
+        }
+        if (car.direction == 0) {
+            car.busy = false;
+            RetryUnassignedCalls();
+        } else {
+            car.fsm.Call(car.direction > 0 ? *car.stops.upper_bound(floor) : *std::prev(car.stops.lower_bound(floor)));
+            Schedule(now_ + config_.floorTravelTime, EventType::CarStep, carIndex);
+        }
+        Dispatch(floor, 1);
+        Dispatch(floor, -1);
+    }
+
+    // Вызовы, оставшиеся без кабины, назначаются заново, когда кабина освобождается
+    void RetryUnassignedCalls() {
+        if (!stats_.unassignedCalls) return;
+        for (int floor = 1; floor <= config_.floors; ++floor) {
+            Dispatch(floor, 1);
+            Dispatch(floor, -1);
+        }
+    }
+
+    void OnCarStep(size_t carIndex) {
+        ElevatorCar& car = cars_[carIndex];
+        if (!car.IsInService()) {
+            car.busy = false;
+            return;
+        }
+        car.position += car.direction;
+        if (car.stops.count(car.position)) {
+            car.stops.erase(car.position);
+            OpenDoors(carIndex);
+        } else {
+            Schedule(now_ + config_.floorTravelTime, EventType::CarStep, carIndex);
+        }
+    }
+
+public:
+    ElevatorBank(const BankConfig& config, IDispatchPolicy* policy)
+        : config_(config), cars_(config.cars), policy_(policy) {
+        for (auto& queues : waiting_) queues.resize(config.floors + 1);
+        for (auto& owners : hallCallOwner_) owners.assign(config.floors + 1, IDispatchPolicy::kNoCar);
+        // Кабины равномерно распределены по высоте здания
+        for (size_t i = 0; i < cars_.size(); ++i) {
+            cars_[i].position = 1 + static_cast<int>(i * (config.floors - 1) / std::max<size_t>(1, cars_.size()));
+            cars_[i].fsm.ChangeState(ElevatorStateId::Standing);
+        }
+    }
+
+    // Добавляет появление пассажира на этаже origin в момент time
+    void AddPassenger(double time, int origin, int destination) {
+        Schedule(time, EventType::PassengerArrival, 0, Passenger{time, origin, destination});
+    }
+
+    // Аварийная остановка кабины через её автомат (Standing/Moving -> Malfunction).
+    // Вызовы этажей, назначенные вышедшей из строя кабине, назначаются заново
+    void Emergency(size_t carIndex) {
+        ElevatorCar& car = cars_[carIndex];
+        car.fsm.Emergency();
+        if (car.IsInService()) return;
+        for (int dir : {1, -1}) {
+            for (int floor = 1; floor <= config_.floors; ++floor) {
+                size_t& owner = hallCallOwner_[DirIndex(dir)][floor];
+                if (owner != carIndex) continue;
+                owner = IDispatchPolicy::kNoCar;
+                Dispatch(floor, dir);
+            }
+        }
+    }
+
+    // Обрабатывает события до момента until
+    void RunUntil(double until) {
+        while (!events_.empty() && events_.top().time <= until) {
+            Event event = events_.top();
+            events_.pop();
+            now_ = event.time;
+            ++stats_.eventsProcessed;
+            switch (event.type) {
+            case EventType::PassengerArrival: {
+                ++stats_.passengersGenerated;
+                int dir = DirectionOf(event.passenger.origin, event.passenger.destination);
+                waiting_[DirIndex(dir)][event.passenger.origin].push_back(event.passenger);
+                Dispatch(event.passenger.origin, dir);
+                break;
+            }
+            case EventType::CarStep: OnCarStep(event.car); break;
+            case EventType::DoorsClosed: OnDoorsClosed(event.car); break;
+            }
+        }
+        now_ = until;
+    }
+
+    const std::vector<ElevatorCar>& GetCars() const { return cars_; }
+    const BankConfig& GetConfig() const { return config_; }
+    // Снимок статистики на текущий момент: доставленные плюс цензурированные
+    // выборки для ожидающих (ожидание до снимка) и едущих пассажиров
+    Stats GetStats() const {
+        Stats snapshot = stats_;
+        for (const auto& queues : waiting_) {
+            for (const auto& queue : queues) {
+                for (const Passenger& p : queue) {
+                    snapshot.passengersUndelivered++;
+                    snapshot.AddSample(now_ - p.arrivalTime, now_ - p.arrivalTime);
+                }
+            }
+        }
+        for (const ElevatorCar& car : cars_) {
+            for (const Passenger& p : car.riders) {
+                snapshot.passengersUndelivered++;
+                snapshot.AddSample(p.pickupTime - p.arrivalTime, now_ - p.arrivalTime);
+            }
+        }
+        return snapshot;
+    }
+    double GetTime() const { return now_; }
+};
+
+// --- Конкретные стратегии ---
+
+// Ближайшая исправная кабина по расстоянию
+class NearestCarPolicy : public IDispatchPolicy {
+public:
+    std::string GetName() const override { return "Nearest car"; }
+    size_t AssignCar(const ElevatorBank& bank, const HallCall& call) override {
+        const auto& cars = bank.GetCars();
+        size_t best = IDispatchPolicy::kNoCar;
+        int bestCost = std::numeric_limits<int>::max();
+        for (size_t i = 0; i < cars.size(); ++i) {
+            if (!cars[i].IsInService()) continue;
+            int cost = std::abs(cars[i].position - call.floor);
+            if (cost < bestCost) { bestCost = cost; best = i; }
+        }
+        return best;
+    }
+};
+
+// LOOK: стоимость — путь кабины до этажа с учетом текущего направления развертки
+class LookPolicy : public IDispatchPolicy {
+protected:
+    static int LookDistance(const ElevatorCar& car, const HallCall& call, int floors) {
+        int distance = std::abs(car.position - call.floor);
+        if (car.direction == 0) return distance;
+        bool ahead = DirectionOf(car.position, call.floor) == car.direction || car.position == call.floor;
+        if (ahead && call.direction == car.direction) return distance;
+        // Иначе кабина сначала доедет до края развертки и вернется
+        int edge = car.direction > 0 ? floors : 1;
+        return std::abs(edge - car.position) + std::abs(edge - call.floor);
+    }
+
+public:
+    std::string GetName() const override { return "LOOK"; }
+    size_t AssignCar(const ElevatorBank& bank, const HallCall& call) override {
+        const auto& cars = bank.GetCars();
+        size_t best = IDispatchPolicy::kNoCar;
+        int bestCost = std::numeric_limits<int>::max();
+        for (size_t i = 0; i < cars.size(); ++i) {
+            if (!cars[i].IsInService()) continue;
+            // Штраф за загрузку выравнивает распределение вызовов
+            int cost = LookDistance(cars[i], call, bank.GetConfig().floors) + 2 * static_cast<int>(cars[i].stops.size());
+            if (cost < bestCost) { bestCost = cost; best = i; }
+        }
+        return best;
+    }
+};
+
+// Диспетчеризация по назначению: пассажиры с общим этажом назначения
+// собираются в одну кабину, если это не сильно удлиняет путь
+class DestinationDispatchPolicy : public LookPolicy {
+public:
+    std::string GetName() const override { return "Destination dispatch"; }
+    size_t AssignCar(const ElevatorBank& bank, const HallCall& call) override {
+        const auto& cars = bank.GetCars();
+        size_t best = IDispatchPolicy::kNoCar;
+        int bestCost = std::numeric_limits<int>::max();
+        for (size_t i = 0; i < cars.size(); ++i) {
+            if (!cars[i].IsInService()) continue;
+            int cost = LookDistance(cars[i], call, bank.GetConfig().floors) + 3 * static_cast<int>(cars[i].stops.size());
+            // Уже запланированные остановки не добавляют новых открытий дверей
+            if (cars[i].stops.count(call.destination)) cost -= 3;
+            if (cars[i].stops.count(call.floor)) cost -= 3;
+            if (cost < bestCost) { bestCost = cost; best = i; }
+        }
+        return best;
+    }
+};
+
+// --- Генератор трафика ---
+// Пуассоновский поток пассажиров; доля поездок с первого этажа задает утренний пик
+inline void GenerateTraffic(ElevatorBank& bank, double duration, double passengersPerMinute,
+                            double lobbyShare, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::exponential_distribution<double> gap(passengersPerMinute / 60.0);
+    std::uniform_int_distribution<int> floor(1, bank.GetConfig().floors);
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    for (double t = gap(rng); t < duration; t += gap(rng)) {
+        int origin = coin(rng) < lobbyShare ? 1 : floor(rng);
+        int destination = floor(rng);
+        while (destination == origin) destination = floor(rng);
+        bank.AddPassenger(t, origin, destination);
+    }
+}
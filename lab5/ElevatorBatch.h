@@ -0,0 +1,167 @@
+#pragma once
+#include "ElevatorFSM.h"
+#include <cstdint>
+#include <vector>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// === Пакетная модель множества независимых лифтов (SoA) ===
+// Для Монте-Карло исследований: состояние, этаж и флаг перегрузки тысяч
+// лифтов хранятся параллельными массивами одинаковой ширины (int32), а шаг
+// по всем лифтам записан без ветвлений. Автовекторизация такого цикла
+// срабатывает только при -O3 (с -march=native), поэтому шаг написан явно на
+// SIMD: 8 лифтов за итерацию с AVX2 (-mavx2 или -march=native), 4 — с SSE2
+// (любой x86-64, хватает -O2); хвост и другие архитектуры — скалярный цикл
+// с той же логикой. Семантика совпадает с IElevatorState:
+// StandingState/MovingState/OverloadedState/NoPowerState/MalfunctionState.
+// Целевой этаж отдельно не хранится: как и в Elevator, Call сразу
+// записывает цель в текущий этаж (SetFloor).
+
+// Коды событий пакета: первые пять совпадают с ElevatorEvent,
+// далее — внешние смены состояния из сценариев и отсутствие события
+enum BatchEvent : int32_t {
+    kBatchCall = static_cast<int32_t>(ElevatorEvent::Call),
+    kBatchLoad = static_cast<int32_t>(ElevatorEvent::Load),
+    kBatchUnload = static_cast<int32_t>(ElevatorEvent::Unload),
+    kBatchRestorePower = static_cast<int32_t>(ElevatorEvent::RestorePower),
+    kBatchEmergency = static_cast<int32_t>(ElevatorEvent::Emergency),
+    kBatchArrival,   // ChangeState(Standing)
+    kBatchPowerLoss, // ChangeState(NoPower)
+    kBatchNone
+};
+
+// Операции над дорожками int32 для явного SIMD-шага; маска — все единицы в дорожке
+#if defined(__AVX2__)
+struct BatchLanes {
+    using Vec = __m256i;
+    static constexpr size_t kWidth = 8;
+    static constexpr const char* kName = "AVX2, 8 elevators per step";
+    static Vec Load(const int32_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    static void Store(int32_t* p, Vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+    static Vec Set(int32_t x) { return _mm256_set1_epi32(x); }
+    static Vec Eq(Vec a, Vec b) { return _mm256_cmpeq_epi32(a, b); }
+    static Vec And(Vec a, Vec b) { return _mm256_and_si256(a, b); }
+    static Vec Or(Vec a, Vec b) { return _mm256_or_si256(a, b); }
+    static Vec AndNot(Vec a, Vec b) { return _mm256_andnot_si256(b, a); } // a & ~b
+    static Vec Select(Vec mask, Vec a, Vec b) { return _mm256_blendv_epi8(b, a, mask); }
+};
+#elif defined(__SSE2__)
+struct BatchLanes {
+    using Vec = __m128i;
+    static constexpr size_t kWidth = 4;
+    static constexpr const char* kName = "SSE2, 4 elevators per step";
+    static Vec Load(const int32_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static void Store(int32_t* p, Vec v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+    static Vec Set(int32_t x) { return _mm_set1_epi32(x); }
+    static Vec Eq(Vec a, Vec b) { return _mm_cmpeq_epi32(a, b); }
+    static Vec And(Vec a, Vec b) { return _mm_and_si128(a, b); }
+    static Vec Or(Vec a, Vec b) { return _mm_or_si128(a, b); }
+    static Vec AndNot(Vec a, Vec b) { return _mm_andnot_si128(b, a); }
+    static Vec Select(Vec mask, Vec a, Vec b) { return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b)); }
+};
+#endif
+
+class ElevatorBatch {
+private:
+    std::vector<int32_t> state_;
+    std::vector<int32_t> floor_;
+    std::vector<int32_t> overloaded_;
+
+public:
+    explicit ElevatorBatch(size_t count)
+        : state_(count, static_cast<int32_t>(ElevatorStateId::Standing)), floor_(count, 1), overloaded_(count, 0) {}
+
+    // Один такт: events[i] и args[i] (этаж для Call) применяются к лифту i
+    void Step(const int32_t* __restrict events, const int32_t* __restrict args) {
+        constexpr int32_t kStanding = static_cast<int32_t>(ElevatorStateId::Standing);
+        constexpr int32_t kMoving = static_cast<int32_t>(ElevatorStateId::Moving);
+        constexpr int32_t kOverloaded = static_cast<int32_t>(ElevatorStateId::Overloaded);
+        constexpr int32_t kNoPower = static_cast<int32_t>(ElevatorStateId::NoPower);
+        constexpr int32_t kMalfunction = static_cast<int32_t>(ElevatorStateId::Malfunction);
+
+        int32_t* __restrict state = state_.data();
+        int32_t* __restrict floor = floor_.data();
+        int32_t* __restrict overloaded = overloaded_.data();
+        const size_t count = state_.size();
+        size_t i = 0;
+
+#if defined(__AVX2__) || defined(__SSE2__)
+        using L = BatchLanes;
+        const auto standingV = L::Set(kStanding), movingV = L::Set(kMoving), overloadedV = L::Set(kOverloaded);
+        const auto noPowerV = L::Set(kNoPower), malfunctionV = L::Set(kMalfunction), zero = L::Set(0), one = L::Set(1);
+        for (; i + L::kWidth <= count; i += L::kWidth) {
+            const auto s = L::Load(state + i), f = L::Load(floor + i), o = L::Load(overloaded + i);
+            const auto e = L::Load(events + i), a = L::Load(args + i);
+
+            const auto standing = L::Eq(s, standingV);
+            const auto moving = L::Eq(s, movingV);
+            const auto overloadedState = L::Eq(s, overloadedV);
+            const auto call = L::Eq(e, L::Set(kBatchCall));
+            const auto notLoaded = L::Eq(o, zero);
+
+            // Те же условия, что в скалярном цикле ниже
+            const auto standingCall = L::AndNot(L::And(standing, call), L::Eq(a, f));
+            const auto startMove = L::And(standingCall, notLoaded);
+            const auto blocked = L::AndNot(standingCall, notLoaded);
+            const auto retarget = L::And(moving, call);
+            const auto load = L::And(standing, L::Eq(e, L::Set(kBatchLoad)));
+            const auto unload = L::And(overloadedState, L::Eq(e, L::Set(kBatchUnload)));
+            const auto restore = L::And(L::Eq(s, noPowerV), L::Eq(e, L::Set(kBatchRestorePower)));
+            const auto emergency = L::And(L::Or(L::Or(standing, moving), overloadedState), L::Eq(e, L::Set(kBatchEmergency)));
+
+            auto next = L::Select(startMove, movingV, s);
+            next = L::Select(L::Or(blocked, load), overloadedV, next);
+            next = L::Select(L::Or(L::Or(unload, restore), L::Eq(e, L::Set(kBatchArrival))), standingV, next);
+            next = L::Select(emergency, malfunctionV, next);
+            next = L::Select(L::Eq(e, L::Set(kBatchPowerLoss)), noPowerV, next);
+
+            L::Store(state + i, next);
+            L::Store(floor + i, L::Select(L::Or(startMove, retarget), a, f));
+            L::Store(overloaded + i, L::Select(load, one, L::Select(unload, zero, o)));
+        }
+#endif
+
+        for (; i < count; ++i) {
+            const int32_t s = state[i], f = floor[i], o = overloaded[i];
+            const int32_t e = events[i], a = args[i];
+
+            const bool standing = s == kStanding;
+            const bool moving = s == kMoving;
+            const bool overloadedState = s == kOverloaded;
+
+            // StandingState::Call: на другой этаж — движение или отказ из-за перегрузки
+            const bool standingCall = standing & (e == kBatchCall) & (a != f);
+            const bool startMove = standingCall & (o == 0);
+            const bool blocked = standingCall & (o != 0);
+            // MovingState::Call меняет цель
+            const bool retarget = moving & (e == kBatchCall);
+            // StandingState::Load -> Overloaded, OverloadedState::Unload -> Standing
+            const bool load = standing & (e == kBatchLoad);
+            const bool unload = overloadedState & (e == kBatchUnload);
+            const bool restore = (s == kNoPower) & (e == kBatchRestorePower);
+            const bool emergency = (standing | moving | overloadedState) & (e == kBatchEmergency);
+
+            int32_t next = s;
+            next = startMove ? kMoving : next;
+            next = (blocked | load) ? kOverloaded : next;
+            next = (unload | restore | (e == kBatchArrival)) ? kStanding : next;
+            next = emergency ? kMalfunction : next;
+            next = (e == kBatchPowerLoss) ? kNoPower : next;
+
+            state[i] = next;
+            floor[i] = (startMove | retarget) ? a : f;
+            overloaded[i] = load ? 1 : (unload ? 0 : o);
+        }
+    }
+
+    size_t Size() const { return state_.size(); }
+#if defined(__AVX2__) || defined(__SSE2__)
+    static const char* KernelName() { return BatchLanes::kName; }
+#else
+    static const char* KernelName() { return "scalar"; }
+#endif
+    ElevatorStateId GetState(size_t i) const { return static_cast<ElevatorStateId>(state_[i]); }
+    int GetFloor(size_t i) const { return floor_[i]; }
+    bool IsOverloaded(size_t i) const { return overloaded_[i] != 0; }
+};
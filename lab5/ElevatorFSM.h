@@ -0,0 +1,162 @@
+#pragma once
+#include <iostream>
+#include <string>
+#include <cstdint>
+
+// === Табличный конечный автомат лифта ===
+// Альтернатива классам-состояниям из ElevatorSystem.h: состояния и события —
+// перечисления, а переходы задаются constexpr-таблицей [состояние][событие].
+// Вывод и наблюдаемое поведение совпадают с StandingState/MovingState/
+// OverloadedState/NoPowerState/MalfunctionState, но без виртуальных вызовов
+// и без объектов-состояний.
+
+// === 1. Состояния и события ===
+enum class ElevatorStateId : uint8_t { Standing, Moving, Overloaded, NoPower, Malfunction, Count };
+enum class ElevatorEvent : uint8_t { Call, Load, Unload, RestorePower, Emergency, Count };
+
+constexpr size_t kElevatorStateCount = static_cast<size_t>(ElevatorStateId::Count);
+constexpr size_t kElevatorEventCount = static_cast<size_t>(ElevatorEvent::Count);
+
+inline const char* ElevatorStateName(ElevatorStateId state) {
+    static const char* names[] = {"Standing", "Moving", "Overloaded", "NoPower", "Malfunction"};
+    return names[static_cast<size_t>(state)];
+}
+
+// Действие над данными лифта, выполняемое при переходе
+enum class TransitionAction : uint8_t {
+    None,
+    StandingCall,  // Проверки этажа и перегрузки, затем Moving или Overloaded
+    SetTarget,     // Смена целевого этажа во время движения
+    SetOverload,   // Флаг перегрузки = true
+    ClearOverload  // Флаг перегрузки = false
+};
+
+struct Transition {
+    ElevatorStateId next;
+    TransitionAction action;
+    const char* before; // Сообщение до смены состояния (nullptr — нет)
+    const char* after;  // Сообщение после смены состояния (nullptr — нет)
+};
+
+// === 2. Лифт на табличном автомате ===
+class TableElevator {
+private:
+    using S = ElevatorStateId;
+    using A = TransitionAction;
+
+public:
+    // Таблица переходов; порядок событий в строке: Call, Load, Unload, RestorePower, Emergency
+    static constexpr Transition kTransitions[kElevatorStateCount][kElevatorEventCount] = {
+        // Standing
+        {{S::Standing, A::StandingCall, nullptr, nullptr},
+         {S::Overloaded, A::SetOverload, "Standing: Loading passengers...", nullptr},
+         {S::Standing, A::None, "Standing: Unloading completed. Doors closed.", nullptr},
+         {S::Standing, A::None, "Standing: Power is already OK. No action.", nullptr},
+         {S::Malfunction, A::None, nullptr, nullptr}},
+        // Moving
+        {{S::Moving, A::SetTarget, nullptr, nullptr},
+         {S::Moving, A::None, "Moving: Cannot load while moving.", nullptr},
+         {S::Moving, A::None, "Moving: Cannot unload while moving.", nullptr},
+         {S::Moving, A::None, "Moving: Power is OK. Continuing movement.", nullptr},
+         {S::Malfunction, A::None, nullptr, nullptr}},
+        // Overloaded
+        {{S::Overloaded, A::None, "Overloaded: Cannot move until unloaded! Alarm active.", nullptr},
+         {S::Overloaded, A::None, "Overloaded: Cannot load more weight. Alarm active.", nullptr},
+         {S::Standing, A::ClearOverload, nullptr, "Overloaded: Weight reduced. State restored to Standing."},
+         {S::Overloaded, A::None, "Overloaded: Power is OK, but elevator is overloaded.", nullptr},
+         {S::Malfunction, A::None, nullptr, nullptr}},
+        // NoPower
+        {{S::NoPower, A::None, "NoPower: Cannot move. Waiting for power restoration.", nullptr},
+         {S::NoPower, A::None, "NoPower: Cannot load. Doors are probably locked.", nullptr},
+         {S::NoPower, A::None, "NoPower: Cannot unload. Doors are probably locked.", nullptr},
+         {S::Standing, A::None, nullptr, "NoPower: Power restored! Elevator is now Standing."},
+         {S::NoPower, A::None, "NoPower: Emergency triggered, but power is already out. Stays in NoPower state.", nullptr}},
+        // Malfunction
+        {{S::Malfunction, A::None, "Malfunction: Emergency stop! Waiting for maintenance.", nullptr},
+         {S::Malfunction, A::None, "Malfunction: Emergency stop! Loading disabled.", nullptr},
+         {S::Malfunction, A::None, "Malfunction: Emergency stop! Unloading disabled.", nullptr},
+         {S::Malfunction, A::None, "Malfunction: Power is restored, but manual reset is required.", nullptr},
+         {S::Malfunction, A::None, "Malfunction: Already in emergency state.", nullptr}},
+    };
+
+private:
+    ElevatorStateId state_;
+    int currentFloor_ = 1;
+    bool isOverloaded_ = false;
+    bool logging_;
+
+    void Log(const char* message) const {
+        if (logging_ && message) std::cout << message << std::endl;
+    }
+
+    void Enter(ElevatorStateId next) {
+        if (logging_) {
+            std::cout << "Context: Changing state from " << ElevatorStateName(state_)
+                      << " to " << ElevatorStateName(next) << std::endl;
+        }
+        state_ = next;
+    }
+
+public:
+    // Обработка события по таблице; floor используется только событием Call
+    void Dispatch(ElevatorEvent event, int floor) {
+        const Transition& t = kTransitions[static_cast<size_t>(state_)][static_cast<size_t>(event)];
+        switch (t.action) {
+        case TransitionAction::StandingCall:
+            if (floor == currentFloor_) {
+                if (logging_) std::cout << "Standing: Already on floor " << floor << "." << std::endl;
+            } else if (isOverloaded_) {
+                Log("Standing: Cannot move, elevator is overloaded.");
+                Enter(ElevatorStateId::Overloaded);
+            } else {
+                if (logging_) std::cout << "Standing: Moving from floor " << currentFloor_ << " to " << floor << "." << std::endl;
+                Enter(ElevatorStateId::Moving);
+                currentFloor_ = floor;
+            }
+            return;
+        case TransitionAction::SetTarget:
+            if (logging_) std::cout << "Moving: Target floor changed to " << floor << ". Continuing movement." << std::endl;
+            currentFloor_ = floor;
+            return;
+        case TransitionAction::SetOverload:
+            Log(t.before);
+            isOverloaded_ = true;
+            break;
+        case TransitionAction::ClearOverload:
+            Log(t.before);
+            isOverloaded_ = false;
+            break;
+        case TransitionAction::None:
+            Log(t.before);
+            break;
+        }
+        if (t.next != state_) Enter(t.next);
+        Log(t.after);
+    }
+
+    explicit TableElevator(ElevatorStateId initialState = ElevatorStateId::Standing, bool logging = true)
+        : state_(initialState), logging_(logging) {
+        if (logging_) std::cout << "Elevator initialized. Current State: " << ElevatorStateName(state_) << std::endl;
+    }
+
+    // Операции (триггеры), как у Elevator
+    void Call(int floor) { Dispatch(ElevatorEvent::Call, floor); }
+    void Load() { Dispatch(ElevatorEvent::Load, 0); }
+    void Unload() { Dispatch(ElevatorEvent::Unload, 0); }
+    void RestorePower() { Dispatch(ElevatorEvent::RestorePower, 0); }
+    void Emergency() { Dispatch(ElevatorEvent::Emergency, 0); }
+
+    // Внешняя смена состояния (аналог Elevator::ChangeState в сценариях)
+    void ChangeState(ElevatorStateId newState) { Enter(newState); }
+
+    void SetFloor(int floor) { currentFloor_ = floor; }
+    int GetFloor() const { return currentFloor_; }
+    bool IsOverloaded() const { return isOverloaded_; }
+    ElevatorStateId GetState() const { return state_; }
+    std::string GetCurrentStateName() const { return ElevatorStateName(state_); }
+    void SetLogging(bool logging) { logging_ = logging; }
+};
+
+static_assert(TableElevator::kTransitions[static_cast<size_t>(ElevatorStateId::Overloaded)]
+                                         [static_cast<size_t>(ElevatorEvent::Unload)].next == ElevatorStateId::Standing,
+              "Unload must resolve overload");
@@ -2,6 +2,7 @@
 #include <iostream>
 #include <string>
 #include <memory>
+#include "PendingStops.h"
 
 class Elevator; // Предварительное объявление класса Контекста
 
@@ -24,36 +25,68 @@ public:
 // Лифт – объект, поведение которого меняется в зависимости от state_
 class Elevator {
 private:
-    std::unique_ptr<IElevatorState> state_;
+    // Состояния — синглтоны (см. GetStandingState и др.), поэтому Контекст
+    // ими не владеет и принимает обычный указатель
+    IElevatorState* state_;
     int currentFloor_;
     bool isOverloaded_ = false;
+    // Очередь вызовов (включается EnableCallQueue): без нее вызов во время
+    // движения перезаписывает цель, с ней — сливается в набор остановок
+    bool queueCalls_ = false;
+    int direction_ = 0;
+    PendingStops<> pendingStops_;
+    // Вывод в консоль (как у TableElevator): без него замеры не тратят время на форматирование
+    bool logging_;
 
 public:
-    Elevator(std::unique_ptr<IElevatorState> initialState) : currentFloor_(1) {
+    explicit Elevator(IElevatorState* initialState, bool logging = true)
+        : state_(initialState), currentFloor_(1), logging_(logging) {
         // Установка начального состояния
-        this->state_ = std::move(initialState);
-        std::cout << "Elevator initialized. Current State: " << state_->GetName() << std::endl;
+        if (logging_) std::cout << "Elevator initialized. Current State: " << state_->GetName() << std::endl;
     }
 
     // Метод для смены состояния
-    void ChangeState(std::unique_ptr<IElevatorState> newState) {
-        std::cout << "Context: Changing state from " << state_->GetName() << " to " << newState->GetName() << std::endl;
-        state_ = std::move(newState);
+    void ChangeState(IElevatorState* newState) {
+        if (logging_) std::cout << "Context: Changing state from " << state_->GetName() << " to " << newState->GetName() << std::endl;
+        state_ = newState;
     }
 
-    // Методы, делегирующие выполнение текущему состоянию
-    void Call(int floor) { state_->Call(this, floor); }
+    // Методы, делегирующие выполнение текущему состоянию.
+    // С очередью вызовов этаж вне диапазона PendingStops отклоняется: его некуда записать
+    void Call(int floor) {
+        if (!AcceptsFloor(floor)) {
+            if (logging_) std::cout << "Context: Floor " << floor << " is out of range. Call rejected." << std::endl;
+            return;
+        }
+        state_->Call(this, floor);
+    }
     void Load() { state_->Load(this); }
     void Unload() { state_->Unload(this); }
     void RestorePower() { state_->RestorePower(this); }
     void Emergency() { state_->Emergency(this); }
     
+    // Прибытие к целевому этажу: продолжение к следующей остановке или Standing
+    void Arrive();
+
     // Вспомогательные методы
     void SetFloor(int floor) { currentFloor_ = floor; }
     int GetFloor() const { return currentFloor_; }
     void SetOverloaded(bool isOverloaded) { isOverloaded_ = isOverloaded; }
     bool IsOverloaded() const { return isOverloaded_; }
     std::string GetCurrentStateName() const { return state_->GetName(); }
+
+    bool AcceptsFloor(int floor) const { return !queueCalls_ || PendingStops<>::InRange(floor); }
+
+    void EnableCallQueue(bool enabled = true) { queueCalls_ = enabled; }
+    bool IsQueueingCalls() const { return queueCalls_; }
+    void SetDirection(int direction) { direction_ = direction; }
+    int GetDirection() const { return direction_; }
+    // Вызов во время движения: этаж добавляется к остановкам относительно текущей цели
+    bool QueueStop(int floor) { return pendingStops_.Merge(floor, currentFloor_, direction_); }
+    const PendingStops<>& GetPendingStops() const { return pendingStops_; }
+
+    void SetLogging(bool logging) { logging_ = logging; }
+    bool IsLogging() const { return logging_; }
 };
 
 // --- Вспомогательные функции для получения экземпляров состояний (Singleton) ---
@@ -74,41 +107,42 @@ public:
     
     void Call(Elevator* elevator, int floor) override {
         if (floor == elevator->GetFloor()) {
-            std::cout << "Standing: Already on floor " << floor << "." << std::endl;
+            if (elevator->IsLogging()) std::cout << "Standing: Already on floor " << floor << "." << std::endl;
             return;
         }
         if (elevator->IsOverloaded()) {
-            std::cout << "Standing: Cannot move, elevator is overloaded." << std::endl;
+            if (elevator->IsLogging()) std::cout << "Standing: Cannot move, elevator is overloaded." << std::endl;
             // Переход в состояние Перегружен
-            elevator->ChangeState(std::unique_ptr<IElevatorState>(GetOverloadedState()));
+            elevator->ChangeState(GetOverloadedState());
             return;
         }
         
-        std::cout << "Standing: Moving from floor " << elevator->GetFloor() << " to " << floor << "." << std::endl;
+        if (elevator->IsLogging()) std::cout << "Standing: Moving from floor " << elevator->GetFloor() << " to " << floor << "." << std::endl;
         // Переход в состояние Движение
-        elevator->ChangeState(std::unique_ptr<IElevatorState>(GetMovingState()));
+        elevator->ChangeState(GetMovingState());
+        elevator->SetDirection(floor > elevator->GetFloor() ? 1 : -1);
         elevator->SetFloor(floor);
     }
 
     void Load(Elevator* elevator) override {
-        std::cout << "Standing: Loading passengers..." << std::endl;
+        if (elevator->IsLogging()) std::cout << "Standing: Loading passengers..." << std::endl;
         // Имитация перегрузки при загрузке
         elevator->SetOverloaded(true);
         // Переход в состояние Перегружен
-        elevator->ChangeState(std::unique_ptr<IElevatorState>(GetOverloadedState()));
+        elevator->ChangeState(GetOverloadedState());
     }
     
     void Unload(Elevator* elevator) override {
-        std::cout << "Standing: Unloading completed. Doors closed." << std::endl;
+        if (elevator->IsLogging()) std::cout << "Standing: Unloading completed. Doors closed." << std::endl;
     }
     
     void RestorePower(Elevator* elevator) override {
-        std::cout << "Standing: Power is already OK. No action." << std::endl;
+        if (elevator->IsLogging()) std::cout << "Standing: Power is already OK. No action." << std::endl;
     }
     
     void Emergency(Elevator* elevator) override {
         // Переход в состояние Авария
-        elevator->ChangeState(std::unique_ptr<IElevatorState>(GetMalfunctionState()));
+        elevator->ChangeState(GetMalfunctionState());
     }
 };
 
@@ -119,25 +153,30 @@ public:
     std::string GetName() const override { return "Moving"; }
 
     void Call(Elevator* elevator, int floor) override {
-        std::cout << "Moving: Target floor changed to " << floor << ". Continuing movement." << std::endl;
+        if (elevator->IsQueueingCalls()) {
+            if (elevator->IsLogging()) std::cout << "Moving: Call to floor " << floor << " queued. Continuing to " << elevator->GetFloor() << "." << std::endl;
+            elevator->QueueStop(floor);
+            return;
+        }
+        if (elevator->IsLogging()) std::cout << "Moving: Target floor changed to " << floor << ". Continuing movement." << std::endl;
         elevator->SetFloor(floor);
     }
 
     void Load(Elevator* elevator) override {
-        std::cout << "Moving: Cannot load while moving." << std::endl;
+        if (elevator->IsLogging()) std::cout << "Moving: Cannot load while moving." << std::endl;
     }
     
     void Unload(Elevator* elevator) override {
-        std::cout << "Moving: Cannot unload while moving." << std::endl;
+        if (elevator->IsLogging()) std::cout << "Moving: Cannot unload while moving." << std::endl;
     }
 
     void RestorePower(Elevator* elevator) override {
-        std::cout << "Moving: Power is OK. Continuing movement." << std::endl;
+        if (elevator->IsLogging()) std::cout << "Moving: Power is OK. Continuing movement." << std::endl;
     }
 
     void Emergency(Elevator* elevator) override {
         // Переход в состояние Авария
-        elevator->ChangeState(std::unique_ptr<IElevatorState>(GetMalfunctionState()));
+        elevator->ChangeState(GetMalfunctionState());
     }
 };
 
@@ -148,27 +187,27 @@ public:
     std::string GetName() const override { return "Overloaded"; }
 
     void Call(Elevator* elevator, int floor) override {
-        std::cout << "Overloaded: Cannot move until unloaded! Alarm active." << std::endl;
+        if (elevator->IsLogging()) std::cout << "Overloaded: Cannot move until unloaded! Alarm active." << std::endl;
     }
 
     void Load(Elevator* elevator) override {
-        std::cout << "Overloaded: Cannot load more weight. Alarm active." << std::endl;
+        if (elevator->IsLogging()) std::cout << "Overloaded: Cannot load more weight. Alarm active." << std::endl;
     }
     
     void Unload(Elevator* elevator) override {
         // После разгрузки (если перегрузка устранена), переходим в Standing
         elevator->SetOverloaded(false);
-        elevator->ChangeState(std::unique_ptr<IElevatorState>(GetStandingState()));
-        std::cout << "Overloaded: Weight reduced. State restored to Standing." << std::endl;
+        elevator->ChangeState(GetStandingState());
+        if (elevator->IsLogging()) std::cout << "Overloaded: Weight reduced. State restored to Standing." << std::endl;
     }
 
     void RestorePower(Elevator* elevator) override {
-        std::cout << "Overloaded: Power is OK, but elevator is overloaded." << std::endl;
+        if (elevator->IsLogging()) std::cout << "Overloaded: Power is OK, but elevator is overloaded." << std::endl;
     }
 
     void Emergency(Elevator* elevator) override {
         // Переход в состояние Авария
-        elevator->ChangeState(std::unique_ptr<IElevatorState>(GetMalfunctionState()));
+        elevator->ChangeState(GetMalfunctionState());
     }
 };
 
@@ -179,25 +218,25 @@ public:
     std::string GetName() const override { return "NoPower"; }
 
     void Call(Elevator* elevator, int floor) override {
-        std::cout << "NoPower: Cannot move. Waiting for power restoration." << std::endl;
+        if (elevator->IsLogging()) std::cout << "NoPower: Cannot move. Waiting for power restoration." << std::endl;
     }
 
     void Load(Elevator* elevator) override {
-        std::cout << "NoPower: Cannot load. Doors are probably locked." << std::endl;
+        if (elevator->IsLogging()) std::cout << "NoPower: Cannot load. Doors are probably locked." << std::endl;
     }
     
     void Unload(Elevator* elevator) override {
-        std::cout << "NoPower: Cannot unload. Doors are probably locked." << std::endl;
+        if (elevator->IsLogging()) std::cout << "NoPower: Cannot unload. Doors are probably locked." << std::endl;
     }
 
     void RestorePower(Elevator* elevator) override {
         // Переход в стоячее состояние
-        elevator->ChangeState(std::unique_ptr<IElevatorState>(GetStandingState()));
-        std::cout << "NoPower: Power restored! Elevator is now Standing." << std::endl;
+        elevator->ChangeState(GetStandingState());
+        if (elevator->IsLogging()) std::cout << "NoPower: Power restored! Elevator is now Standing." << std::endl;
     }
 
     void Emergency(Elevator* elevator) override {
-        std::cout << "NoPower: Emergency triggered, but power is already out. Stays in NoPower state." << std::endl;
+        if (elevator->IsLogging()) std::cout << "NoPower: Emergency triggered, but power is already out. Stays in NoPower state." << std::endl;
     }
 };
 
@@ -208,23 +247,23 @@ public:
     std::string GetName() const override { return "Malfunction"; }
 
     void Call(Elevator* elevator, int floor) override {
-        std::cout << "Malfunction: Emergency stop! Waiting for maintenance." << std::endl;
+        if (elevator->IsLogging()) std::cout << "Malfunction: Emergency stop! Waiting for maintenance." << std::endl;
     }
 
     void Load(Elevator* elevator) override {
-        std::cout << "Malfunction: Emergency stop! Loading disabled." << std::endl;
+        if (elevator->IsLogging()) std::cout << "Malfunction: Emergency stop! Loading disabled." << std::endl;
     }
     
     void Unload(Elevator* elevator) override {
-        std::cout << "Malfunction: Emergency stop! Unloading disabled." << std::endl;
+        if (elevator->IsLogging()) std::cout << "Malfunction: Emergency stop! Unloading disabled." << std::endl;
     }
 
     void RestorePower(Elevator* elevator) override {
-        std::cout << "Malfunction: Power is restored, but manual reset is required." << std::endl;
+        if (elevator->IsLogging()) std::cout << "Malfunction: Power is restored, but manual reset is required." << std::endl;
     }
 
     void Emergency(Elevator* elevator) override {
-        std::cout << "Malfunction: Already in emergency state." << std::endl;
+        if (elevator->IsLogging()) std::cout << "Malfunction: Already in emergency state." << std::endl;
     }
 };
 
@@ -233,4 +272,20 @@ IElevatorState* GetStandingState() { static StandingState instance; return &inst
 IElevatorState* GetMovingState() { static MovingState instance; return &instance; }
 IElevatorState* GetOverloadedState() { static OverloadedState instance; return &instance; }
 IElevatorState* GetNoPowerState() { static NoPowerState instance; return &instance; }
-IElevatorState* GetMalfunctionState() { static MalfunctionState instance; return &instance; }
\ No newline at end of file
+IElevatorState* GetMalfunctionState() { static MalfunctionState instance; return &instance; }
+
+// --- Прибытие к цели ---
+inline void Elevator::Arrive() {
+    if (state_ != GetMovingState()) return;
+    pendingStops_.Take(currentFloor_);
+    int next = queueCalls_ ? pendingStops_.Next(currentFloor_, direction_) : 0;
+    if (next == 0) {
+        direction_ = 0;
+        ChangeState(GetStandingState());
+        return;
+    }
+    if (logging_) std::cout << "Context: Arrived at floor " << currentFloor_ << ". Next stop: " << next << "." << std::endl;
+    direction_ = next > currentFloor_ ? 1 : -1;
+    pendingStops_.Take(next);
+    currentFloor_ = next;
+}
@@ -0,0 +1,315 @@
+#pragma once
+#include "ElevatorSystem.h"
+#include "ElevatorFSM.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+// === Ядро дискретно-событийного моделирования (DES) ===
+// Календарная очередь (Brown, 1988) дает O(1) в среднем на вставку и
+// извлечение, события берутся из пула без обращений к куче. Поверх ядра —
+// воспроизведение трафика для лифтов: события вызывают Elevator::Call/Load/
+// Unload/Emergency (или те же методы TableElevator) в модельном времени.
+
+// === 1. Событие ===
+struct SimEvent {
+    double time;
+    uint64_t sequence; // Порядок событий с одинаковым временем (детерминизм)
+    uint32_t target;   // Индекс объекта модели (например, лифта)
+    uint16_t kind;     // Тип события, определяется моделью
+    int32_t arg;       // Аргумент (например, этаж для Call)
+    SimEvent* next;    // Связь в корзине календаря или в списке свободных
+
+    bool Before(const SimEvent& other) const {
+        return time != other.time ? time < other.time : sequence < other.sequence;
+    }
+};
+
+// === 2. Пул событий ===
+// Память выделяется блоками; освобожденные события возвращаются в список свободных
+class EventPool {
+private:
+    static constexpr size_t kChunkSize = 4096;
+    std::vector<std::unique_ptr<SimEvent[]>> chunks_;
+    SimEvent* free_ = nullptr;
+
+    void Grow() {
+        chunks_.emplace_back(new SimEvent[kChunkSize]);
+        SimEvent* chunk = chunks_.back().get();
+        for (size_t i = 0; i < kChunkSize; ++i) {
+            chunk[i].next = free_;
+            free_ = &chunk[i];
+        }
+    }
+
+public:
+    SimEvent* Acquire() {
+        if (!free_) Grow();
+        SimEvent* event = free_;
+        free_ = event->next;
+        return event;
+    }
+
+    void Release(SimEvent* event) {
+        event->next = free_;
+        free_ = event;
+    }
+
+    size_t GetCapacity() const { return chunks_.size() * kChunkSize; }
+};
+
+// === 3. Календарная очередь ===
+class CalendarQueue {
+private:
+    std::vector<SimEvent*> buckets_; // Отсортированные односвязные списки
+    size_t mask_ = 0;
+    double width_ = 1.0;      // Ширина корзины ("день" календаря)
+    size_t size_ = 0;
+    uint64_t currentDay_ = 0; // Номер текущего "дня" (абсолютный, без деления на год)
+    double lastTime_ = 0.0;   // Время последнего извлеченного события
+    std::vector<SimEvent*> scratch_;
+
+    // Целочисленный номер дня исключает накопление ошибки округления
+    uint64_t DayOf(double time) const { return static_cast<uint64_t>(time / width_); }
+
+    void SetPosition(double time) { currentDay_ = DayOf(time); }
+
+    void Insert(SimEvent* event) {
+        SimEvent** link = &buckets_[DayOf(event->time) & mask_];
+        while (*link && (*link)->Before(*event)) link = &(*link)->next;
+        event->next = *link;
+        *link = event;
+    }
+
+    // Оценка ширины корзины по среднему интервалу между ближайшими событиями
+    double EstimateWidth() {
+        size_t sample = std::min<size_t>(scratch_.size(), 25);
+        if (sample < 2) return width_;
+        std::partial_sort(scratch_.begin(), scratch_.begin() + sample, scratch_.end(),
+                          [](const SimEvent* a, const SimEvent* b) { return a->Before(*b); });
+        double total = scratch_[sample - 1]->time - scratch_[0]->time;
+        double average = total / (sample - 1);
+        double filtered = 0.0;
+        size_t count = 0;
+        for (size_t i = 1; i < sample; ++i) {
+            double gap = scratch_[i]->time - scratch_[i - 1]->time;
+            if (gap <= 2.0 * average) { filtered += gap; ++count; }
+        }
+        double width = count && filtered > 0.0 ? 3.0 * filtered / count : width_;
+        return width > 0.0 ? width : width_;
+    }
+
+    void Resize(size_t bucketCount) {
+        scratch_.clear();
+        for (SimEvent* head : buckets_) {
+            for (SimEvent* e = head; e; e = e->next) scratch_.push_back(e);
+        }
+        width_ = EstimateWidth();
+        buckets_.assign(bucketCount, nullptr);
+        mask_ = bucketCount - 1;
+        for (SimEvent* event : scratch_) Insert(event);
+        SetPosition(lastTime_);
+    }
+
+public:
+    explicit CalendarQueue(size_t initialBuckets = 2) : buckets_(initialBuckets, nullptr), mask_(initialBuckets - 1) {}
+
+    void Enqueue(SimEvent* event) {
+        if (size_ == 0) SetPosition(std::max(event->time, lastTime_));
+        Insert(event);
+        if (++size_ > 2 * buckets_.size()) Resize(buckets_.size() * 2);
+    }
+
+    SimEvent* Dequeue() {
+        if (size_ == 0) return nullptr;
+        for (size_t n = 0; n <= mask_; ++n) {
+            SimEvent*& head = buckets_[currentDay_ & mask_];
+            if (head && DayOf(head->time) <= currentDay_) {
+                SimEvent* event = head;
+                head = event->next;
+                lastTime_ = event->time;
+                if (--size_ < buckets_.size() / 2 && buckets_.size() > 2) Resize(buckets_.size() / 2);
+                return event;
+            }
+            ++currentDay_;
+        }
+        // За "год" событие не найдено: прямой поиск минимума по головам корзин
+        SimEvent* best = nullptr;
+        for (SimEvent* head : buckets_) {
+            if (head && (!best || head->Before(*best))) best = head;
+        }
+        SetPosition(best->time);
+        return Dequeue();
+    }
+
+    // Возвращает только что извлеченное событие и откатывает позицию календаря
+    // к моменту resumeTime (событие оказалось за горизонтом моделирования)
+    void Requeue(SimEvent* event, double resumeTime) {
+        Insert(event);
+        ++size_;
+        lastTime_ = resumeTime;
+        SetPosition(resumeTime);
+    }
+
+    size_t Size() const { return size_; }
+    bool Empty() const { return size_ == 0; }
+};
+
+// === 4. Симулятор ===
+class Simulator {
+private:
+    EventPool pool_;
+    CalendarQueue queue_;
+    double now_ = 0.0;
+    uint64_t sequence_ = 0;
+    uint64_t processed_ = 0;
+
+public:
+    void ScheduleAt(double time, uint16_t kind, uint32_t target, int32_t arg = 0) {
+        SimEvent* event = pool_.Acquire();
+        event->time = time;
+        event->sequence = sequence_++;
+        event->target = target;
+        event->kind = kind;
+        event->arg = arg;
+        queue_.Enqueue(event);
+    }
+
+    void ScheduleIn(double delay, uint16_t kind, uint32_t target, int32_t arg = 0) {
+        ScheduleAt(now_ + delay, kind, target, arg);
+    }
+
+    // Обрабатывает события до момента until или до исчерпания лимита;
+    // handler(sim, event) может планировать новые события
+    template <typename Handler>
+    uint64_t Run(double until, uint64_t maxEvents, Handler&& handler) {
+        uint64_t count = 0;
+        while (count < maxEvents && !queue_.Empty()) {
+            SimEvent* next = queue_.Dequeue();
+            if (next->time > until) {
+                queue_.Requeue(next, now_); // Событие за горизонтом остается в очереди
+                break;
+            }
+            SimEvent event = *next;
+            pool_.Release(next);
+            now_ = event.time;
+            handler(*this, event);
+            ++count;
+        }
+        processed_ += count;
+        return count;
+    }
+
+    double Now() const { return now_; }
+    uint64_t GetProcessed() const { return processed_; }
+    size_t GetPending() const { return queue_.Size(); }
+};
+
+// === 5. Воспроизведение трафика лифтов ===
+// Каждый лифт проходит цикл: вызов -> прибытие -> загрузка -> разгрузка -> простой,
+// изредка — авария с ремонтом или отключение питания.
+enum ElevatorSimEvent : uint16_t { kSimCall, kSimArrival, kSimLoad, kSimUnload, kSimEmergency,
+                                   kSimMaintenance, kSimPowerLoss, kSimRestorePower, kSimEventKinds };
+
+// Внешние смены состояния (как в сценариях main_state.cpp) для обоих вариантов лифта
+inline void ForceState(Elevator& elevator, ElevatorStateId state) {
+    elevator.ChangeState(state == ElevatorStateId::NoPower ? GetNoPowerState() : GetStandingState());
+}
+
+inline void ForceState(TableElevator& elevator, ElevatorStateId state) { elevator.ChangeState(state); }
+
+struct TrafficProfile {
+    int floors = 20;
+    double floorTravelTime = 1.5;  // с
+    double doorTime = 4.0;         // с
+    double dwellTime = 8.0;        // Загрузка/разгрузка, с
+    double meanIdleTime = 30.0;    // Средний простой между вызовами, с
+    double emergencyChance = 1e-4; // На цикл
+    double powerLossChance = 1e-4; // На цикл
+    double repairTime = 3600.0;    // с
+    double outageTime = 600.0;     // с
+};
+
+template <typename ElevatorT>
+class ElevatorTrafficReplay {
+private:
+    std::vector<ElevatorT*> elevators_;
+    TrafficProfile profile_;
+    Simulator simulator_;
+    std::mt19937_64 rng_;
+    std::uniform_int_distribution<int> floor_;
+    std::exponential_distribution<double> idle_;
+    std::uniform_real_distribution<double> chance_{0.0, 1.0};
+    uint64_t counts_[kSimEventKinds] = {};
+
+    void Handle(Simulator& sim, const SimEvent& event) {
+        ElevatorT& elevator = *elevators_[event.target];
+        ++counts_[event.kind];
+        switch (event.kind) {
+        case kSimCall: {
+            int from = elevator.GetFloor();
+            elevator.Call(event.arg);
+            double travel = std::abs(event.arg - from) * profile_.floorTravelTime;
+            sim.ScheduleIn(travel + profile_.doorTime, kSimArrival, event.target);
+            break;
+        }
+        case kSimArrival:
+            ForceState(elevator, ElevatorStateId::Standing);
+            sim.ScheduleIn(profile_.dwellTime, kSimLoad, event.target);
+            break;
+        case kSimLoad:
+            elevator.Load();
+            sim.ScheduleIn(profile_.dwellTime, kSimUnload, event.target);
+            break;
+        case kSimUnload: {
+            elevator.Unload();
+            double r = chance_(rng_);
+            if (r < profile_.emergencyChance) {
+                sim.ScheduleIn(profile_.doorTime, kSimEmergency, event.target);
+            } else if (r < profile_.emergencyChance + profile_.powerLossChance) {
+                sim.ScheduleIn(profile_.doorTime, kSimPowerLoss, event.target);
+            } else {
+                sim.ScheduleIn(idle_(rng_), kSimCall, event.target, floor_(rng_));
+            }
+            break;
+        }
+        case kSimEmergency:
+            elevator.Emergency();
+            sim.ScheduleIn(profile_.repairTime, kSimMaintenance, event.target);
+            break;
+        case kSimMaintenance:
+            ForceState(elevator, ElevatorStateId::Standing);
+            sim.ScheduleIn(idle_(rng_), kSimCall, event.target, floor_(rng_));
+            break;
+        case kSimPowerLoss:
+            ForceState(elevator, ElevatorStateId::NoPower);
+            sim.ScheduleIn(profile_.outageTime, kSimRestorePower, event.target);
+            break;
+        case kSimRestorePower:
+            elevator.RestorePower();
+            sim.ScheduleIn(idle_(rng_), kSimCall, event.target, floor_(rng_));
+            break;
+        }
+    }
+
+public:
+    ElevatorTrafficReplay(std::vector<ElevatorT*> elevators, const TrafficProfile& profile, uint64_t seed)
+        : elevators_(std::move(elevators)), profile_(profile), rng_(seed),
+          floor_(1, profile.floors), idle_(1.0 / profile.meanIdleTime) {
+        for (uint32_t i = 0; i < elevators_.size(); ++i) {
+            simulator_.ScheduleAt(idle_(rng_), kSimCall, i, floor_(rng_));
+        }
+    }
+
+    // Воспроизводит трафик до модельного времени until (не более maxEvents событий)
+    uint64_t Run(double until, uint64_t maxEvents = UINT64_MAX) {
+        return simulator_.Run(until, maxEvents,
+                              [this](Simulator& sim, const SimEvent& event) { Handle(sim, event); });
+    }
+
+    double Now() const { return simulator_.Now(); }
+    uint64_t GetCount(ElevatorSimEvent kind) const { return counts_[kind]; }
+};
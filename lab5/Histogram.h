@@ -0,0 +1,55 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+// === Гистограмма с фиксированными корзинами ===
+// Корзины одинаковой ширины плюс корзина переполнения. Счетчики целые,
+// поэтому слияние (Merge) коммутативно и не зависит от порядка: результаты
+// потоков и повторов можно складывать в любом порядке.
+class Histogram {
+private:
+    double width_;
+    std::vector<uint64_t> counts_; // Последняя корзина — переполнение
+    uint64_t total_ = 0;
+
+public:
+    explicit Histogram(double width = 1.0, size_t bins = 1024) : width_(width), counts_(bins + 1, 0) {}
+
+    void Add(double value) {
+        size_t bin = value <= 0.0 ? 0 : static_cast<size_t>(value / width_);
+        ++counts_[std::min(bin, counts_.size() - 1)];
+        ++total_;
+    }
+
+    void Merge(const Histogram& other) {
+        if (other.width_ != width_ || other.counts_.size() != counts_.size()) {
+            throw std::invalid_argument("Histogram layouts differ");
+        }
+        for (size_t i = 0; i < counts_.size(); ++i) counts_[i] += other.counts_[i];
+        total_ += other.total_;
+    }
+
+    // Квантиль q в [0, 1] с линейной интерполяцией внутри корзины;
+    // квантиль, попавший в корзину переполнения, — бесконечность
+    double Quantile(double q) const {
+        if (total_ == 0) return 0.0;
+        double rank = q * total_;
+        uint64_t seen = 0;
+        for (size_t i = 0; i + 1 < counts_.size(); ++i) {
+            if (counts_[i] && seen + counts_[i] >= rank) {
+                return (i + std::max(0.0, (rank - seen) / counts_[i])) * width_;
+            }
+            seen += counts_[i];
+        }
+        return std::numeric_limits<double>::infinity();
+    }
+
+    double GetWidth() const { return width_; }
+    size_t GetBins() const { return counts_.size() - 1; }
+    uint64_t GetCount(size_t bin) const { return counts_[bin]; }
+    uint64_t GetOverflow() const { return counts_.back(); }
+    uint64_t GetTotal() const { return total_; }
+};
@@ -0,0 +1,113 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// === Очередь остановок лифта (битовые множества по направлениям) ===
+// Этажи хранятся битами двух множеств: остановки при движении вверх и при
+// движении вниз. Вставка, удаление и запрос "следующая остановка по ходу"
+// выполняются за O(1): просматривается фиксированное число машинных слов
+// (MaxFloors / 64), внутри слова — одна инструкция ctz/clz. Этажи вне
+// [1, MaxFloors] отклоняются: Add/Merge возвращают false и ничего не меняют.
+template <size_t MaxFloors = 128>
+class PendingStops {
+public:
+    static constexpr size_t kWords = (MaxFloors + 64) / 64; // Этажи 1..MaxFloors, бит 0 не используется
+
+private:
+    uint64_t up_[kWords] = {};
+    uint64_t down_[kWords] = {};
+
+    static bool Test(const uint64_t* bits, int floor) { return (bits[floor >> 6] >> (floor & 63)) & 1; }
+    static void Set(uint64_t* bits, int floor) { bits[floor >> 6] |= uint64_t(1) << (floor & 63); }
+    static void Reset(uint64_t* bits, int floor) { bits[floor >> 6] &= ~(uint64_t(1) << (floor & 63)); }
+
+    // Наименьший установленный бит строго выше floor (0 — нет)
+    static int LowestAbove(const uint64_t* bits, int floor) {
+        int start = floor + 1;
+        size_t word = static_cast<size_t>(start) >> 6;
+        if (word >= kWords) return 0;
+        uint64_t masked = bits[word] & (~uint64_t(0) << (start & 63));
+        while (true) {
+            if (masked) return static_cast<int>(word * 64 + __builtin_ctzll(masked));
+            if (++word == kWords) return 0;
+            masked = bits[word];
+        }
+    }
+
+    // Наибольший установленный бит строго ниже floor (0 — нет)
+    static int HighestBelow(const uint64_t* bits, int floor) {
+        if (floor <= 0) return 0;
+        int last = floor - 1;
+        size_t word = static_cast<size_t>(last) >> 6;
+        if (word >= kWords) { word = kWords - 1; last = static_cast<int>(kWords * 64 - 1); }
+        uint64_t masked = bits[word] & (~uint64_t(0) >> (63 - (last & 63)));
+        while (true) {
+            if (masked) return static_cast<int>(word * 64 + 63 - __builtin_clzll(masked));
+            if (word-- == 0) return 0;
+            masked = bits[word];
+        }
+    }
+
+    static int Lowest(const uint64_t* bits) { return LowestAbove(bits, 0); }
+    static int Highest(const uint64_t* bits) { return HighestBelow(bits, static_cast<int>(kWords * 64)); }
+
+public:
+    static constexpr bool InRange(int floor) { return floor >= 1 && floor <= static_cast<int>(MaxFloors); }
+
+    // Остановка, которую нужно обслужить при движении в направлении direction (+1/-1)
+    bool Add(int floor, int direction) {
+        if (!InRange(floor)) return false;
+        Set(direction > 0 ? up_ : down_, floor);
+        return true;
+    }
+
+    // Слияние вызова, поступившего во время движения к reference в направлении direction:
+    // этаж по ходу попадает в текущую развертку, остальные — в обратную
+    bool Merge(int floor, int reference, int direction) {
+        if (!InRange(floor)) return false;
+        if (floor == reference) return true;
+        bool ahead = direction >= 0 ? floor > reference : floor < reference;
+        int sweep = direction == 0 ? (floor > reference ? 1 : -1) : direction;
+        return Add(floor, ahead ? sweep : -sweep);
+    }
+
+    // Остановка на этаже обслуживает вызовы обоих направлений
+    void Take(int floor) {
+        if (!InRange(floor)) return;
+        Reset(up_, floor);
+        Reset(down_, floor);
+    }
+
+    // Следующая остановка по алгоритму LOOK (0 — очередь пуста):
+    // сначала остановки по ходу, затем самая дальняя остановка обратной развертки,
+    // затем ближайшая остановка следующей развертки
+    int Next(int position, int direction) const {
+        if (direction == 0) direction = LowestAbove(up_, position) || LowestAbove(down_, position) ? 1 : -1;
+        if (direction > 0) {
+            if (int stop = LowestAbove(up_, position)) return stop;
+            if (int stop = Highest(down_)) return stop;
+            return Lowest(up_);
+        }
+        if (int stop = HighestBelow(down_, position)) return stop;
+        if (int stop = Lowest(up_)) return stop;
+        return Highest(down_);
+    }
+
+    bool Contains(int floor) const { return InRange(floor) && (Test(up_, floor) || Test(down_, floor)); }
+
+    size_t Count() const {
+        size_t count = 0;
+        for (size_t i = 0; i < kWords; ++i) count += __builtin_popcountll(up_[i] | down_[i]);
+        return count;
+    }
+
+    bool Empty() const {
+        uint64_t any = 0;
+        for (size_t i = 0; i < kWords; ++i) any |= up_[i] | down_[i];
+        return any == 0;
+    }
+
+    void Clear() {
+        for (size_t i = 0; i < kWords; ++i) up_[i] = down_[i] = 0;
+    }
+};
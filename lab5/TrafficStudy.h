@@ -0,0 +1,160 @@
+#pragma once
+#include "ElevatorBank.h"
+#include <atomic>
+#include <functional>
+#include <ostream>
+#include <thread>
+
+// === Параллельное исследование трафика методом Монте-Карло ===
+// Сетка сценариев (этажность, число кабин, интенсивность потока) прогоняется
+// на ElevatorBank многократно с разными зернами. Задачи (сценарий, повтор)
+// раздаются потокам через атомарный счетчик и не имеют общих данных, поэтому
+// время масштабируется линейно с числом ядер. Зерно задачи выводится из
+// базового зерна и номера задачи, а итоги сливаются в порядке задач —
+// результат не зависит от числа потоков. Пассажиры, не доставленные к концу
+// прогона, входят в ожидание цензурированными выборками (см. ElevatorBank::Stats).
+
+// === 1. Сценарий и результат ===
+struct StudyScenario {
+    int floors = 20;
+    size_t cars = 4;
+    double perMinute = 60.0;
+    double lobbyShare = 0.3;
+    double hours = 1.0;
+};
+
+struct StudyResult {
+    StudyScenario scenario;
+    size_t replications = 0;
+    uint64_t generated = 0;
+    uint64_t delivered = 0;
+    uint64_t undelivered = 0;
+    uint64_t events = 0;
+    double totalWait = 0.0;
+    double totalTrip = 0.0;
+    double maxWait = 0.0;
+    Histogram wait{1.0, 1800};
+    Histogram trip{1.0, 1800};
+
+    double AvgWait() const { return delivered + undelivered ? totalWait / (delivered + undelivered) : 0.0; }
+    double AvgTrip() const { return delivered + undelivered ? totalTrip / (delivered + undelivered) : 0.0; }
+
+    void Merge(const ElevatorBank::Stats& stats) {
+        ++replications;
+        generated += stats.passengersGenerated;
+        delivered += stats.passengersDelivered;
+        undelivered += stats.passengersUndelivered;
+        events += stats.eventsProcessed;
+        totalWait += stats.totalWait;
+        totalTrip += stats.totalTrip;
+        maxWait = std::max(maxWait, stats.maxWait);
+        wait.Merge(stats.waitHistogram);
+        trip.Merge(stats.tripHistogram);
+    }
+};
+
+// Независимые зерна для задач (SplitMix64): соседние номера дают некоррелированные потоки
+inline uint64_t StudySeed(uint64_t base, uint64_t task) {
+    uint64_t z = base + (task + 1) * 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// === 2. Исполнитель исследования ===
+class TrafficStudy {
+public:
+    using PolicyFactory = std::function<std::unique_ptr<IDispatchPolicy>()>;
+
+private:
+    std::vector<StudyScenario> scenarios_;
+    PolicyFactory makePolicy_;
+    uint64_t seed_;
+
+    // Один прогон: здание, трафик из собственного зерна, развоз оставшихся пассажиров
+    ElevatorBank::Stats RunOne(const StudyScenario& scenario, uint64_t seed) const {
+        BankConfig config;
+        config.floors = scenario.floors;
+        config.cars = scenario.cars;
+        std::unique_ptr<IDispatchPolicy> policy = makePolicy_();
+        ElevatorBank bank(config, policy.get());
+        double duration = scenario.hours * 3600.0;
+        GenerateTraffic(bank, duration, scenario.perMinute, scenario.lobbyShare, seed);
+        bank.RunUntil(duration + 3600.0);
+        return bank.GetStats();
+    }
+
+public:
+    explicit TrafficStudy(uint64_t seed = 2024, PolicyFactory makePolicy = [] { return std::make_unique<LookPolicy>(); })
+        : makePolicy_(std::move(makePolicy)), seed_(seed) {}
+
+    void AddScenario(const StudyScenario& scenario) { scenarios_.push_back(scenario); }
+
+    // Декартово произведение параметров
+    void Sweep(const std::vector<int>& floors, const std::vector<size_t>& cars,
+               const std::vector<double>& perMinute, double hours) {
+        for (int f : floors) {
+            for (size_t c : cars) {
+                for (double rate : perMinute) {
+                    StudyScenario scenario;
+                    scenario.floors = f;
+                    scenario.cars = c;
+                    scenario.perMinute = rate;
+                    scenario.hours = hours;
+                    AddScenario(scenario);
+                }
+            }
+        }
+    }
+
+    std::vector<StudyResult> Run(size_t replications, size_t threads) const {
+        const size_t tasks = scenarios_.size() * replications;
+        std::vector<ElevatorBank::Stats> outcomes(tasks);
+        std::atomic<size_t> nextTask{0};
+
+        auto worker = [&] {
+            for (size_t task = nextTask.fetch_add(1); task < tasks; task = nextTask.fetch_add(1)) {
+                outcomes[task] = RunOne(scenarios_[task / replications], StudySeed(seed_, task));
+            }
+        };
+        std::vector<std::thread> pool;
+        for (size_t i = 1; i < std::max<size_t>(1, threads); ++i) pool.emplace_back(worker);
+        worker();
+        for (auto& t : pool) t.join();
+
+        // Слияние в порядке задач: суммы с плавающей точкой детерминированы
+        std::vector<StudyResult> results(scenarios_.size());
+        for (size_t s = 0; s < scenarios_.size(); ++s) {
+            results[s].scenario = scenarios_[s];
+            for (size_t r = 0; r < replications; ++r) results[s].Merge(outcomes[s * replications + r]);
+        }
+        return results;
+    }
+
+    size_t GetScenarioCount() const { return scenarios_.size(); }
+};
+
+// === 3. Вывод в CSV ===
+inline void WriteStudyCsv(std::ostream& out, const std::vector<StudyResult>& results) {
+    out << "floors,cars,arrivals_per_min,replications,generated,delivered,undelivered,avg_wait_s,p50_wait_s,p90_wait_s,"
+           "p99_wait_s,max_wait_s,avg_trip_s,p99_trip_s,wait_overflow,events\n";
+    for (const StudyResult& r : results) {
+        out << r.scenario.floors << ',' << r.scenario.cars << ',' << r.scenario.perMinute << ','
+            << r.replications << ',' << r.generated << ',' << r.delivered << ',' << r.undelivered << ',' << r.AvgWait() << ',' << r.wait.Quantile(0.5) << ','
+            << r.wait.Quantile(0.9) << ',' << r.wait.Quantile(0.99) << ',' << r.maxWait << ','
+            << r.AvgTrip() << ',' << r.trip.Quantile(0.99) << ',' << r.wait.GetOverflow() << ',' << r.events << '\n';
+    }
+}
+
+// Гистограммы ожидания: по строке на непустую корзину
+inline void WriteWaitHistogramCsv(std::ostream& out, const std::vector<StudyResult>& results) {
+    out << "floors,cars,arrivals_per_min,bin_start_s,count\n";
+    for (const StudyResult& r : results) {
+        for (size_t bin = 0; bin <= r.wait.GetBins(); ++bin) {
+            if (uint64_t count = r.wait.GetCount(bin)) {
+                out << r.scenario.floors << ',' << r.scenario.cars << ',' << r.scenario.perMinute << ','
+                    << bin * r.wait.GetWidth() << ',' << count << '\n';
+            }
+        }
+    }
+}
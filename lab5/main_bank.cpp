@@ -0,0 +1,73 @@
+#include "ElevatorBank.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+
+// Параметры: [этажей] [кабин] [пассажиров в минуту] [длительность, ч]
+int main(int argc, char* argv[]) {
+    std::cout << "--- Elevator Bank Simulator (Dispatch Strategies) ---" << std::endl;
+
+    BankConfig config;
+    config.floors = argc > 1 ? std::atoi(argv[1]) : 30;
+    config.cars = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 32;
+    double perMinute = argc > 3 ? std::atof(argv[3]) : 120.0;
+    double hours = argc > 4 ? std::atof(argv[4]) : 2.0;
+    double duration = hours * 3600.0;
+
+    std::cout << "[Bank] Floors: " << config.floors << ", cars: " << config.cars
+              << ", arrivals: " << perMinute << "/min, simulated: " << hours << " h" << std::endl;
+
+    NearestCarPolicy nearest;
+    LookPolicy look;
+    DestinationDispatchPolicy destination;
+    IDispatchPolicy* policies[] = {&nearest, &look, &destination};
+
+    std::cout << std::fixed << std::setprecision(1);
+    for (IDispatchPolicy* policy : policies) {
+        ElevatorBank bank(config, policy);
+        // Одинаковый поток пассажиров для всех стратегий (общий seed)
+        GenerateTraffic(bank, duration, perMinute, 0.3, 2024);
+
+        auto start = std::chrono::steady_clock::now();
+        // Дополнительный час на развоз оставшихся пассажиров
+        bank.RunUntil(duration + 3600.0);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        ElevatorBank::Stats stats = bank.GetStats();
+        std::cout << "\n[" << policy->GetName() << "]" << std::endl;
+        std::cout << "  Delivered: " << stats.passengersDelivered << " of " << stats.passengersGenerated
+                  << " passengers, undelivered: " << stats.passengersUndelivered << std::endl;
+        std::cout << "  Avg wait: " << stats.AvgWait() << " s, max wait: " << stats.maxWait << " s" << std::endl;
+        std::cout << "  Avg trip (wait + ride): " << stats.AvgTrip() << " s" << std::endl;
+        std::cout << "  Simulated events: " << stats.eventsProcessed << " ("
+                  << stats.eventsProcessed / seconds / 1e6 << " M events/s)" << std::endl;
+    }
+
+    // Все кабины в аварии: вызовы не назначаются и остаются в очереди этажей,
+    // ожидание считается до конца прогона
+    BankConfig small;
+    small.cars = 2;
+    ElevatorBank stalled(small, &look);
+    stalled.Emergency(0);
+    stalled.Emergency(1);
+    GenerateTraffic(stalled, 600.0, 30.0, 0.3, 7);
+    stalled.RunUntil(1200.0);
+    ElevatorBank::Stats stalledStats = stalled.GetStats();
+    std::cout << "\n[All cars out of service] Delivered: " << stalledStats.passengersDelivered << " of "
+              << stalledStats.passengersGenerated << ", unassigned calls: " << stalledStats.unassignedCalls
+              << ", avg wait (censored): " << stalledStats.AvgWait() << " s" << std::endl;
+
+    // Кабина, которой назначен вызов, выходит из строя: вызов переходит к исправной
+    NearestCarPolicy failoverPolicy;
+    ElevatorBank failover(small, &failoverPolicy);
+    failover.AddPassenger(0.0, 2, 5);
+    failover.RunUntil(0.5);
+    failover.Emergency(0);
+    failover.AddPassenger(100.0, 2, 7);
+    failover.RunUntil(3600.0);
+    ElevatorBank::Stats failoverStats = failover.GetStats();
+    std::cout << "[Assigned car fails] Delivered: " << failoverStats.passengersDelivered << " of "
+              << failoverStats.passengersGenerated << ", avg wait: " << failoverStats.AvgWait() << " s" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include "ElevatorSystem.h"
+#include "ElevatorBatch.h"
+#include <chrono>
+#include <cstdlib>
+#include <random>
+
+// Применение события пакета к скалярным реализациям
+void Apply(Elevator& elevator, int32_t event, int32_t floor) {
+    switch (event) {
+    case kBatchCall: elevator.Call(floor); break;
+    case kBatchLoad: elevator.Load(); break;
+    case kBatchUnload: elevator.Unload(); break;
+    case kBatchRestorePower: elevator.RestorePower(); break;
+    case kBatchEmergency: elevator.Emergency(); break;
+    case kBatchArrival: elevator.ChangeState(GetStandingState()); break;
+    case kBatchPowerLoss: elevator.ChangeState(GetNoPowerState()); break;
+    default: break;
+    }
+}
+
+void Apply(TableElevator& elevator, int32_t event, int32_t floor) {
+    if (event < kBatchArrival) elevator.Dispatch(static_cast<ElevatorEvent>(event), floor);
+    else if (event == kBatchArrival) elevator.ChangeState(ElevatorStateId::Standing);
+    else if (event == kBatchPowerLoss) elevator.ChangeState(ElevatorStateId::NoPower);
+}
+
+// Случайная трасса: events[tick * cars + car]
+void MakeTrace(size_t cars, size_t ticks, unsigned seed, std::vector<int32_t>& events, std::vector<int32_t>& args) {
+    std::mt19937 rng(seed);
+    events.resize(cars * ticks);
+    args.resize(cars * ticks);
+    for (size_t i = 0; i < events.size(); ++i) {
+        unsigned r = rng() % 100;
+        events[i] = r < 30 ? kBatchCall : r < 42 ? kBatchLoad : r < 58 ? kBatchUnload : r < 64 ? kBatchRestorePower
+                  : r < 65 ? kBatchEmergency : r < 67 ? kBatchPowerLoss : r < 85 ? kBatchArrival : kBatchNone;
+        args[i] = 1 + static_cast<int32_t>(rng() % 30);
+    }
+}
+
+template <typename ElevatorT>
+bool Same(const ElevatorT& scalar, const ElevatorBatch& batch, size_t i) {
+    return scalar.GetFloor() == batch.GetFloor(i) && scalar.IsOverloaded() == batch.IsOverloaded(i) &&
+           scalar.GetCurrentStateName() == ElevatorStateName(batch.GetState(i));
+}
+
+template <typename Func>
+double Seconds(Func func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Параметры: [число лифтов] [тактов]
+int main(int argc, char* argv[]) {
+    std::cout << "--- Elevator System (Batched SoA Stepping) ---" << std::endl;
+
+    // 1. Совпадение с Elevator и TableElevator на случайных трассах
+    // Число лифтов не кратно ширине ядра (4 и 8 дорожек): проверяется и скалярный хвост
+    const size_t checkCars = 259, checkTicks = 500;
+    std::vector<int32_t> events, args;
+    MakeTrace(checkCars, checkTicks, 11, events, args);
+
+    // Скалярные лифты без вывода: иначе они печатают каждое событие
+    std::vector<std::unique_ptr<Elevator>> virtualCars;
+    std::vector<TableElevator> tableCars(checkCars, TableElevator(ElevatorStateId::Standing, false));
+    for (size_t i = 0; i < checkCars; ++i) {
+        virtualCars.push_back(std::make_unique<Elevator>(GetStandingState(), false));
+    }
+    ElevatorBatch checkBatch(checkCars);
+    bool agree = true;
+    for (size_t t = 0; t < checkTicks; ++t) {
+        const int32_t* e = &events[t * checkCars];
+        const int32_t* a = &args[t * checkCars];
+        checkBatch.Step(e, a);
+        for (size_t i = 0; i < checkCars; ++i) {
+            Apply(*virtualCars[i], e[i], a[i]);
+            Apply(tableCars[i], e[i], a[i]);
+            agree = agree && Same(*virtualCars[i], checkBatch, i) && Same(tableCars[i], checkBatch, i);
+        }
+    }
+    std::cout << "\n[Check] Batch agrees with Elevator and TableElevator on "
+              << checkCars * checkTicks << " events: " << (agree ? "yes" : "no") << std::endl;
+
+    // 2. Замер: все лифты продвигаются на такт
+    size_t cars = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4096;
+    size_t ticks = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2000;
+    MakeTrace(cars, ticks, 12, events, args);
+
+    ElevatorBatch batch(cars);
+    double batchSeconds = Seconds([&] {
+        for (size_t t = 0; t < ticks; ++t) batch.Step(&events[t * cars], &args[t * cars]);
+    });
+
+    std::vector<TableElevator> scalar(cars, TableElevator(ElevatorStateId::Standing, false));
+    double scalarSeconds = Seconds([&] {
+        for (size_t t = 0; t < ticks; ++t) {
+            for (size_t i = 0; i < cars; ++i) Apply(scalar[i], events[t * cars + i], args[t * cars + i]);
+        }
+    });
+
+    std::vector<std::unique_ptr<Elevator>> virtualScalar;
+    for (size_t i = 0; i < cars; ++i) {
+        virtualScalar.push_back(std::make_unique<Elevator>(GetStandingState(), false));
+    }
+    double virtualSeconds = Seconds([&] {
+        for (size_t t = 0; t < ticks; ++t) {
+            for (size_t i = 0; i < cars; ++i) Apply(*virtualScalar[i], events[t * cars + i], args[t * cars + i]);
+        }
+    });
+
+    bool finalAgree = true;
+    for (size_t i = 0; i < cars; ++i) finalAgree = finalAgree && Same(scalar[i], batch, i);
+
+    double total = static_cast<double>(cars) * ticks;
+    std::cout << "\n--- Benchmark (" << cars << " elevators x " << ticks << " ticks, batch kernel: "
+              << ElevatorBatch::KernelName() << ") ---" << std::endl;
+    std::cout << "[Bench] Virtual-state Elevator: " << total / virtualSeconds / 1e6 << " M elevator-steps/s" << std::endl;
+    std::cout << "[Bench] Scalar TableElevator:   " << total / scalarSeconds / 1e6 << " M elevator-steps/s" << std::endl;
+    std::cout << "[Bench] Batched SoA stepping:   " << total / batchSeconds / 1e6 << " M elevator-steps/s" << std::endl;
+    std::cout << "[Bench] Speedup vs scalar table: " << scalarSeconds / batchSeconds << "x" << std::endl;
+    std::cout << "[Bench] Final states agree: " << (finalAgree ? "yes" : "no") << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include "EventSimulation.h"
+#include <chrono>
+#include <cstdlib>
+#include <queue>
+
+// Очередь с приоритетом на двоичной куче — эталон для сравнения
+struct HeapQueue {
+    struct Later {
+        bool operator()(const SimEvent* a, const SimEvent* b) const { return b->Before(*a); }
+    };
+    std::priority_queue<SimEvent*, std::vector<SimEvent*>, Later> heap;
+    void Enqueue(SimEvent* e) { heap.push(e); }
+    SimEvent* Dequeue() { SimEvent* e = heap.top(); heap.pop(); return e; }
+};
+
+// Классическая модель "hold": извлечь минимум и вставить событие со случайной задержкой
+template <typename Queue>
+double HoldBenchmark(Queue& queue, size_t pending, uint64_t operations, std::vector<uint64_t>* order) {
+    EventPool pool;
+    std::mt19937_64 rng(99);
+    std::exponential_distribution<double> delay(1.0);
+    uint64_t sequence = 0;
+    for (size_t i = 0; i < pending; ++i) {
+        SimEvent* e = pool.Acquire();
+        e->time = delay(rng);
+        e->sequence = sequence++;
+        queue.Enqueue(e);
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < operations; ++i) {
+        SimEvent* e = queue.Dequeue();
+        if (order) order->push_back(e->sequence);
+        e->time += delay(rng);
+        e->sequence = sequence++;
+        queue.Enqueue(e);
+    }
+    return operations / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Параметры: [событий в воспроизведении] [число лифтов]
+int main(int argc, char* argv[]) {
+    std::cout << "--- Elevator System (Discrete-Event Simulation) ---" << std::endl;
+
+    // 1. Короткое воспроизведение на исходном Elevator с паттерном Состояние
+    std::cout << "\n--- Replay on virtual-state Elevator (first 8 events) ---" << std::endl;
+    Elevator lobbyElevator{GetStandingState()};
+    TrafficProfile profile;
+    ElevatorTrafficReplay<Elevator> demo({&lobbyElevator}, profile, 1);
+    demo.Run(1e9, 8);
+    std::cout << "[DES] Simulated time: " << demo.Now() << " s" << std::endl;
+
+    // 2. Порядок извлечения совпадает с двоичной кучей
+    std::vector<uint64_t> calendarOrder, heapOrder;
+    CalendarQueue calendar;
+    HeapQueue heap;
+    HoldBenchmark(calendar, 1000, 200000, &calendarOrder);
+    HoldBenchmark(heap, 1000, 200000, &heapOrder);
+    std::cout << "\n[Check] Calendar queue order matches binary heap: "
+              << (calendarOrder == heapOrder ? "yes" : "no") << std::endl;
+
+    // 3. Скорость очередей в модели hold
+    std::cout << "\n--- Hold benchmark (10^7 operations) ---" << std::endl;
+    for (size_t pending : {1000, 100000}) {
+        CalendarQueue cq;
+        HeapQueue hq;
+        double calendarRate = HoldBenchmark(cq, pending, 10000000, nullptr);
+        double heapRate = HoldBenchmark(hq, pending, 10000000, nullptr);
+        std::cout << "[Bench] " << pending << " pending: calendar queue " << calendarRate / 1e6
+                  << " M ops/s, binary heap " << heapRate / 1e6 << " M ops/s" << std::endl;
+    }
+
+    // 4. Воспроизведение трафика здания на табличном автомате
+    uint64_t events = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000000;
+    size_t elevatorCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1000;
+    std::vector<TableElevator> elevators;
+    elevators.reserve(elevatorCount);
+    std::vector<TableElevator*> pointers;
+    for (size_t i = 0; i < elevatorCount; ++i) {
+        elevators.emplace_back(ElevatorStateId::Standing, false);
+        pointers.push_back(&elevators.back());
+    }
+    ElevatorTrafficReplay<TableElevator> replay(pointers, profile, 7);
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t processed = replay.Run(1e18, events);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "\n--- Building replay (" << elevatorCount << " elevators) ---" << std::endl;
+    std::cout << "[DES] Events: " << processed << " in " << seconds << " s ("
+              << processed / seconds / 1e6 << " M events/s)" << std::endl;
+    std::cout << "[DES] Simulated time: " << replay.Now() / 86400.0 << " days" << std::endl;
+    std::cout << "[DES] Calls: " << replay.GetCount(kSimCall) << ", emergencies: " << replay.GetCount(kSimEmergency)
+              << ", power losses: " << replay.GetCount(kSimPowerLoss) << std::endl;
+
+    return 0;
+}
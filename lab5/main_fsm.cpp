@@ -0,0 +1,121 @@
+#include "ElevatorSystem.h"
+#include "ElevatorFSM.h"
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+#include <vector>
+
+// Событие трассы: триггеры автомата и внешние смены состояния из сценариев
+enum class TraceEvent { Call, Load, Unload, RestorePower, Emergency, PowerLoss, Arrival };
+
+struct TraceStep {
+    TraceEvent event;
+    int floor;
+};
+
+std::vector<TraceStep> MakeTrace(size_t length, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<TraceStep> trace(length);
+    for (auto& step : trace) {
+        unsigned r = rng() % 100;
+        // Аварии и отключения редки, чтобы автомат не застревал в Malfunction
+        step.event = r < 40 ? TraceEvent::Call : r < 55 ? TraceEvent::Load : r < 75 ? TraceEvent::Unload
+                   : r < 82 ? TraceEvent::RestorePower : r < 83 ? TraceEvent::Emergency
+                   : r < 86 ? TraceEvent::PowerLoss : TraceEvent::Arrival;
+        step.floor = 1 + static_cast<int>(rng() % 20);
+    }
+    return trace;
+}
+
+// Прибытие и обслуживание: сценарий вручную возвращает лифт в Standing
+void Apply(Elevator& elevator, const TraceStep& step) {
+    switch (step.event) {
+    case TraceEvent::Call: elevator.Call(step.floor); break;
+    case TraceEvent::Load: elevator.Load(); break;
+    case TraceEvent::Unload: elevator.Unload(); break;
+    case TraceEvent::RestorePower: elevator.RestorePower(); break;
+    case TraceEvent::Emergency: elevator.Emergency(); break;
+    case TraceEvent::PowerLoss: elevator.ChangeState(GetNoPowerState()); break;
+    case TraceEvent::Arrival: elevator.ChangeState(GetStandingState()); break;
+    }
+}
+
+void Apply(TableElevator& elevator, const TraceStep& step) {
+    switch (step.event) {
+    case TraceEvent::Call: elevator.Call(step.floor); break;
+    case TraceEvent::Load: elevator.Load(); break;
+    case TraceEvent::Unload: elevator.Unload(); break;
+    case TraceEvent::RestorePower: elevator.RestorePower(); break;
+    case TraceEvent::Emergency: elevator.Emergency(); break;
+    case TraceEvent::PowerLoss: elevator.ChangeState(ElevatorStateId::NoPower); break;
+    case TraceEvent::Arrival: elevator.ChangeState(ElevatorStateId::Standing); break;
+    }
+}
+
+template <typename ElevatorT>
+double EventsPerSecond(ElevatorT& elevator, const std::vector<TraceStep>& trace, int& checksum) {
+    auto start = std::chrono::steady_clock::now();
+    for (const TraceStep& step : trace) {
+        Apply(elevator, step);
+        checksum += elevator.GetFloor();
+    }
+    return trace.size() / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Параметры: [длина трассы для замера]
+int main(int argc, char* argv[]) {
+    std::cout << "--- Elevator System (Table-Driven FSM) ---" << std::endl;
+
+    // 1. Тот же сценарий, что и в main_state.cpp, на табличном автомате
+    TableElevator elevator;
+    elevator.Call(5);
+    elevator.ChangeState(ElevatorStateId::Standing);
+    elevator.Load();
+    elevator.Call(10);
+    elevator.Unload();
+    elevator.ChangeState(ElevatorStateId::NoPower);
+    elevator.RestorePower();
+    elevator.Emergency();
+    elevator.Call(1);
+
+    // 2. Сравнение вывода и состояния с Elevator на случайной трассе
+    std::vector<TraceStep> checkTrace = MakeTrace(20000, 1);
+    std::ostringstream virtualOut, tableOut;
+    std::streambuf* original = std::cout.rdbuf(virtualOut.rdbuf());
+    Elevator reference{GetStandingState()};
+    std::cout.rdbuf(tableOut.rdbuf());
+    TableElevator candidate;
+    std::cout.rdbuf(original);
+
+    bool sameState = true;
+    for (const TraceStep& step : checkTrace) {
+        std::cout.rdbuf(virtualOut.rdbuf());
+        Apply(reference, step);
+        std::cout.rdbuf(tableOut.rdbuf());
+        Apply(candidate, step);
+        sameState = sameState && reference.GetFloor() == candidate.GetFloor() &&
+                    reference.IsOverloaded() == candidate.IsOverloaded() &&
+                    reference.GetCurrentStateName() == candidate.GetCurrentStateName();
+    }
+    std::cout.rdbuf(original);
+    std::cout << "\n[Check] States match on " << checkTrace.size() << " events: " << (sameState ? "yes" : "no") << std::endl;
+    std::cout << "[Check] Console output matches: " << (virtualOut.str() == tableOut.str() ? "yes" : "no") << std::endl;
+
+    // 3. Замер событий в секунду (вывод отключен для обеих реализаций)
+    size_t length = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+    std::vector<TraceStep> trace = MakeTrace(length, 2);
+    int checksumVirtual = 0, checksumTable = 0;
+
+    Elevator virtualElevator(GetStandingState(), false);
+    double virtualRate = EventsPerSecond(virtualElevator, trace, checksumVirtual);
+    TableElevator tableElevator(ElevatorStateId::Standing, false);
+    double tableRate = EventsPerSecond(tableElevator, trace, checksumTable);
+
+    std::cout << "\n--- Benchmark (" << length << " events) ---" << std::endl;
+    std::cout << "[Bench] Virtual-state Elevator: " << virtualRate / 1e6 << " M events/s" << std::endl;
+    std::cout << "[Bench] Table-driven FSM:       " << tableRate / 1e6 << " M events/s" << std::endl;
+    std::cout << "[Bench] Checksums match: " << (checksumVirtual == checksumTable ? "yes" : "no") << std::endl;
+
+    return 0;
+}
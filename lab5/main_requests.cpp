@@ -0,0 +1,197 @@
+#include "ElevatorSystem.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <set>
+#include <vector>
+
+// Очередь остановок на std::set (как в ElevatorCar) — эталон для сравнения
+struct SetStops {
+    std::set<int> up, down;
+
+    void Merge(int floor, int reference, int direction) {
+        if (!PendingStops<>::InRange(floor) || floor == reference) return; // Те же границы, что у битовой очереди
+        bool ahead = direction >= 0 ? floor > reference : floor < reference;
+        int sweep = direction == 0 ? (floor > reference ? 1 : -1) : direction;
+        (ahead == (sweep > 0) ? up : down).insert(floor);
+    }
+    void Take(int floor) { up.erase(floor); down.erase(floor); }
+    int Next(int position, int direction) const {
+        if (direction == 0) direction = up.upper_bound(position) != up.end() || down.upper_bound(position) != down.end() ? 1 : -1;
+        if (direction > 0) {
+            auto it = up.upper_bound(position);
+            if (it != up.end()) return *it;
+            if (!down.empty()) return *down.rbegin();
+            return up.empty() ? 0 : *up.begin();
+        }
+        auto it = down.lower_bound(position);
+        if (it != down.begin()) return *std::prev(it);
+        if (!up.empty()) return *up.begin();
+        return down.empty() ? 0 : *down.rbegin();
+    }
+};
+
+// Поток вызовов на один лифт: время ожидания от вызова до прибытия на этаж
+struct WaitReport {
+    uint64_t calls = 0, served = 0, rejected = 0;
+    double totalWait = 0.0, maxWait = 0.0;
+};
+
+WaitReport RunCallLoad(bool queueCalls, int floors, double callsPerMinute, double duration, unsigned seed) {
+    const double floorTime = 1.5, doorTime = 4.0;
+    std::mt19937_64 rng(seed);
+    std::exponential_distribution<double> gap(callsPerMinute / 60.0);
+    std::uniform_int_distribution<int> floorDist(1, floors);
+
+    Elevator elevator{GetStandingState()};
+    elevator.EnableCallQueue(queueCalls);
+    std::vector<std::vector<double>> waiting(floors + 1); // Время вызовов по этажам
+    WaitReport report;
+
+    int departFloor = 1;
+    double departTime = 0.0, arrivalTime = 0.0;
+    bool moving = false;
+    auto depart = [&](int from, double now) {
+        departFloor = from;
+        departTime = now;
+        arrivalTime = now + std::abs(elevator.GetFloor() - from) * floorTime + doorTime;
+        moving = true;
+    };
+    auto serve = [&](int floor, double now) {
+        for (double t : waiting[floor]) {
+            report.totalWait += now - t;
+            report.maxWait = std::max(report.maxWait, now - t);
+            ++report.served;
+        }
+        waiting[floor].clear();
+    };
+
+    double nextCall = gap(rng);
+    while (nextCall < duration || moving) {
+        if (moving && (arrivalTime <= nextCall || nextCall >= duration)) {
+            double now = arrivalTime;
+            int floor = elevator.GetFloor();
+            serve(floor, now);
+            elevator.Arrive();
+            moving = false;
+            if (elevator.GetCurrentStateName() == "Moving") depart(floor, now);
+            continue;
+        }
+        double now = nextCall;
+        nextCall += gap(rng);
+        int floor = floorDist(rng);
+        ++report.calls;
+        if (!elevator.AcceptsFloor(floor)) {
+            ++report.rejected; // Этаж выше, чем помещается в очередь остановок
+            continue;
+        }
+        bool wasMoving = moving;
+        // Текущий этаж кабины по времени в пути
+        int position = elevator.GetFloor();
+        if (wasMoving) {
+            int travelled = std::min<int>(std::abs(position - departFloor), static_cast<int>((now - departTime) / floorTime));
+            position = departFloor + (position > departFloor ? travelled : -travelled);
+        }
+        if (!wasMoving && floor == position) {
+            ++report.served; // Лифт уже стоит на этаже
+            continue;
+        }
+        waiting[floor].push_back(now);
+        int target = elevator.GetFloor();
+        elevator.Call(floor);
+        if (!wasMoving) depart(position, now);
+        else if (elevator.GetFloor() != target) depart(position, now); // Цель перезаписана
+    }
+    return report;
+}
+
+template <typename Func>
+double Seconds(Func func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Параметры: [этажей] [вызовов в минуту]
+int main(int argc, char* argv[]) {
+    std::cout << "--- Elevator System (Pending Stop Queue) ---" << std::endl;
+
+    // 1. Вызовы во время движения сливаются в очередь остановок
+    std::cout << "\n--- Scenario with call queue ---" << std::endl;
+    Elevator elevator{GetStandingState()};
+    elevator.EnableCallQueue();
+    elevator.Call(10);
+    elevator.Call(5);
+    elevator.Call(15);
+    elevator.Call(3);
+    elevator.Call(300); // Вне очереди остановок — отклоняется
+    elevator.Call(-1);
+    for (int i = 0; i < 4; ++i) elevator.Arrive();
+    std::cout << "[Queue] Final state: " << elevator.GetCurrentStateName() << " on floor " << elevator.GetFloor() << std::endl;
+
+    int floors = argc > 1 ? std::atoi(argv[1]) : 40;
+    double callsPerMinute = argc > 2 ? std::atof(argv[2]) : 12.0;
+    floors = std::max(2, floors);
+
+    // 2. Ожидание под нагрузкой: перезапись цели против очереди остановок
+    std::cout.setstate(std::ios::badbit);
+    WaitReport overwrite = RunCallLoad(false, floors, callsPerMinute, 8 * 3600.0, 5);
+    WaitReport queued = RunCallLoad(true, floors, callsPerMinute, 8 * 3600.0, 5);
+    std::cout.clear();
+    std::cout << "\n--- Heavy call load (" << floors << " floors, " << callsPerMinute << " calls/min, 8 h) ---" << std::endl;
+    for (auto& [name, r] : {std::make_pair("Overwrite target", overwrite), std::make_pair("Pending stops", queued)}) {
+        std::cout << "[Load] " << name << ": served " << r.served << " of " << r.calls << " calls, rejected "
+                  << r.rejected << ", lost " << r.calls - r.served - r.rejected << ", avg wait " << (r.served ? r.totalWait / r.served : 0.0)
+                  << " s, max wait " << r.maxWait << " s" << std::endl;
+    }
+
+    // 3. Пропускная способность очереди: слияние вызова + следующая остановка + снятие
+    const int operations = 20000000;
+    std::mt19937 rng(3);
+    std::vector<int> calls(1 << 16);
+    for (int& c : calls) c = 1 + static_cast<int>(rng() % floors);
+    size_t mask = calls.size() - 1;
+
+    long checksumBits = 0, checksumSet = 0;
+    PendingStops<> bits;
+    double bitsSeconds = Seconds([&] {
+        int position = 1, direction = 1;
+        for (int i = 0; i < operations; ++i) {
+            bits.Merge(calls[i & mask], position, direction);
+            bits.Merge(calls[(i + 7) & mask], position, direction);
+            int next = bits.Next(position, direction);
+            if (next) { direction = next > position ? 1 : -1; position = next; bits.Take(next); }
+            checksumBits += next;
+        }
+    });
+    SetStops tree;
+    double setSeconds = Seconds([&] {
+        int position = 1, direction = 1;
+        for (int i = 0; i < operations; ++i) {
+            tree.Merge(calls[i & mask], position, direction);
+            tree.Merge(calls[(i + 7) & mask], position, direction);
+            int next = tree.Next(position, direction);
+            if (next) { direction = next > position ? 1 : -1; position = next; tree.Take(next); }
+            checksumSet += next;
+        }
+    });
+    std::cout << "\n--- Queue throughput (" << operations << " call+next+take steps) ---" << std::endl;
+    std::cout << "[Bench] std::set stops: " << operations / setSeconds / 1e6 << " M steps/s" << std::endl;
+    std::cout << "[Bench] Bitset stops:   " << operations / bitsSeconds / 1e6 << " M steps/s" << std::endl;
+    std::cout << "[Bench] Same stop sequence: " << (checksumBits == checksumSet ? "yes" : "no") << std::endl;
+
+    // 4. Вызовы через состояния Elevator с очередью
+    Elevator loaded(GetStandingState(), false);
+    loaded.EnableCallQueue();
+    double elevatorSeconds = Seconds([&] {
+        for (int i = 0; i < operations / 4; ++i) {
+            loaded.Call(calls[i & mask]);
+            if ((i & 3) == 3) loaded.Arrive();
+        }
+    });
+    std::cout << "[Bench] Elevator Call/Arrive with queue: " << operations / 4 / elevatorSeconds / 1e6
+              << " M calls/s" << std::endl;
+
+    return 0;
+}
@@ -9,7 +9,7 @@ void RunElevatorScenario(Elevator& elevator) {
     
     // 2. Имитация прибытия и остановки
     std::cout << "\n[Step 2] Elevator arrives and stops. (Manual state change for scenario)" << std::endl;
-    elevator.ChangeState(std::unique_ptr<IElevatorState>(GetStandingState()));
+    elevator.ChangeState(GetStandingState());
     
     // 3. Загрузка пассажиров (имитируем перегрузку)
     std::cout << "\n[Step 3] Loading passengers (causing overload)." << std::endl;
@@ -25,7 +25,7 @@ void RunElevatorScenario(Elevator& elevator) {
     
     // 6. Имитация потери питания
     std::cout << "\n[Step 6] Power outage simulation (Manual state change for scenario)." << std::endl;
-    elevator.ChangeState(std::unique_ptr<IElevatorState>(GetNoPowerState()));
+    elevator.ChangeState(GetNoPowerState());
     
     // 7. Восстановление питания
     std::cout << "\n[Step 7] Restoring power." << std::endl;
@@ -47,7 +47,7 @@ int main() {
 
     // Инициализация лифта в состоянии "Standing"
     // ИСПРАВЛЕНО: Заменены () на {} для предотвращения Most Vexing Parse
-    Elevator elevator{std::unique_ptr<IElevatorState>(GetStandingState())}; 
+    Elevator elevator{GetStandingState()}; 
     
     RunElevatorScenario(elevator);
 
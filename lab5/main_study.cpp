@@ -0,0 +1,73 @@
+#include "TrafficStudy.h"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+// Параметры: [потоков] [повторов на сценарий] [файл CSV]
+int main(int argc, char* argv[]) {
+    std::cout << "--- Elevator Bank (Monte Carlo Traffic Study) ---" << std::endl;
+
+    size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+    size_t threads = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : hardware;
+    size_t replications = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 8;
+    std::string csvPath = argc > 3 ? argv[3] : "traffic_study.csv";
+
+    TrafficStudy study(2024);
+    study.Sweep({10, 20, 40}, {2, 4, 8}, {30.0, 60.0, 120.0}, 2.0);
+    std::cout << "[Study] Scenarios: " << study.GetScenarioCount() << ", replications: " << replications
+              << ", threads: " << threads << " (hardware: " << hardware << ")" << std::endl;
+
+    // 1. Основной прогон и запись CSV
+    auto start = std::chrono::steady_clock::now();
+    std::vector<StudyResult> results = study.Run(replications, threads);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::ofstream csv(csvPath);
+    WriteStudyCsv(csv, results);
+    std::string histogramPath = csvPath.substr(0, csvPath.rfind('.')) + "_wait_hist.csv";
+    std::ofstream histogramCsv(histogramPath);
+    WriteWaitHistogramCsv(histogramCsv, results);
+
+    uint64_t events = 0;
+    for (const StudyResult& r : results) events += r.events;
+    std::cout << "[Study] " << study.GetScenarioCount() * replications << " runs, " << events << " events in "
+              << seconds << " s" << std::endl;
+    std::cout << "[Study] Results: " << csvPath << ", wait histograms: " << histogramPath << std::endl;
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "\n--- Selected scenarios (20 floors) ---" << std::endl;
+    // Квантиль за пределами гистограммы (ожидание дольше 1800 с) — только нижняя граница
+    auto quantile = [](const Histogram& h, double q) {
+        double value = h.Quantile(q);
+        std::ostringstream text;
+        if (std::isinf(value)) text << "> " << h.GetBins() * h.GetWidth();
+        else text << std::fixed << std::setprecision(1) << value;
+        return text.str();
+    };
+    for (const StudyResult& r : results) {
+        if (r.scenario.floors != 20) continue;
+        std::cout << "[Study] " << r.scenario.cars << " cars, " << r.scenario.perMinute << "/min: avg wait "
+                  << r.AvgWait() << " s, p90 " << quantile(r.wait, 0.9) << " s, p99 " << quantile(r.wait, 0.99)
+                  << " s, undelivered " << r.undelivered << " of " << r.generated << std::endl;
+    }
+
+    // 2. Масштабирование и детерминизм: тот же CSV при любом числе потоков
+    std::ostringstream reference;
+    WriteStudyCsv(reference, results);
+    std::cout << std::setprecision(2) << "\n--- Scaling (same study, varying threads) ---" << std::endl;
+    double baseSeconds = 0.0;
+    for (size_t n = 1; n <= std::max<size_t>(4, hardware); n *= 2) {
+        auto begin = std::chrono::steady_clock::now();
+        std::vector<StudyResult> rerun = study.Run(replications, n);
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        if (n == 1) baseSeconds = elapsed;
+        std::ostringstream csvText;
+        WriteStudyCsv(csvText, rerun);
+        std::cout << "[Scale] " << n << " threads: " << elapsed << " s, speedup " << baseSeconds / elapsed
+                  << "x, identical results: " << (csvText.str() == reference.str() ? "yes" : "no") << std::endl;
+    }
+
+    return 0;
+}
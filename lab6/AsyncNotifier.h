@@ -0,0 +1,147 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+// --- Асинхронная доставка оповещений Наблюдателя ---
+// Производители (контроллер, модели) публикуют "грязные" объекты в lock-free
+// MPSC-очередь; выделенный поток раз в кадр забирает их и вызывает Deliver().
+// Публикация — один атомарный обмен указателя, контроллер не ждет представлений.
+
+// Объект, оповещение которого можно отложить до кадра доставки
+class IDeferredNotifier {
+public:
+    virtual ~IDeferredNotifier() = default;
+    virtual void Deliver() = 0;
+};
+
+// Очередь Вьюкова: много производителей, один потребитель, без блокировок.
+// Узел-заглушка (stub) всегда остается в хвосте, поэтому очередь не бывает пустой структурно.
+template <typename T>
+class MpscQueue {
+private:
+    struct Node {
+        std::atomic<Node*> next{nullptr};
+        T value{};
+    };
+
+    alignas(64) std::atomic<Node*> head_; // Сторона производителей
+    alignas(64) Node* tail_;              // Сторона потребителя
+
+public:
+    MpscQueue() {
+        Node* stub = new Node;
+        head_.store(stub, std::memory_order_relaxed);
+        tail_ = stub;
+    }
+
+    ~MpscQueue() {
+        T ignored;
+        while (TryPop(ignored)) {}
+        delete tail_;
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    void Push(T value) {
+        Node* node = new Node;
+        node->value = value;
+        Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    // Только поток-потребитель
+    bool TryPop(T& value) {
+        Node* tail = tail_;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (!next) return false;
+        value = next->value;
+        tail_ = next;
+        delete tail;
+        return true;
+    }
+};
+
+// Поток доставки: кадр каждые framePeriod или по запросу Flush()
+class NotificationDispatcher {
+private:
+    MpscQueue<IDeferredNotifier*> queue_;
+    std::chrono::microseconds framePeriod_;
+    std::atomic<bool> running_{true};
+    std::atomic<uint64_t> posted_{0};
+    std::atomic<uint64_t> delivered_{0};
+    std::atomic<uint64_t> frames_{0};
+
+    std::mutex mutex_; // Только для Flush и остановки, не для Post
+    std::condition_variable wake_;
+    std::condition_variable frameDone_;
+    uint64_t flushRequested_ = 0;
+    uint64_t flushServed_ = 0;
+    std::thread thread_;
+
+    void DeliverFrame() {
+        IDeferredNotifier* notifier = nullptr;
+        uint64_t count = 0;
+        while (queue_.TryPop(notifier)) {
+            notifier->Deliver();
+            ++count;
+        }
+        delivered_.fetch_add(count, std::memory_order_relaxed);
+        frames_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void Loop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (running_.load(std::memory_order_acquire)) {
+            wake_.wait_for(lock, framePeriod_, [this] {
+                return flushRequested_ != flushServed_ || !running_.load(std::memory_order_acquire);
+            });
+            uint64_t target = flushRequested_;
+            lock.unlock();
+            DeliverFrame();
+            lock.lock();
+            flushServed_ = target;
+            frameDone_.notify_all();
+        }
+    }
+
+public:
+    explicit NotificationDispatcher(std::chrono::microseconds framePeriod = std::chrono::microseconds(16000))
+        : framePeriod_(framePeriod), thread_([this] { Loop(); }) {}
+
+    // Остаток очереди доставляется до остановки потока
+    ~NotificationDispatcher() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            running_.store(false, std::memory_order_release);
+        }
+        wake_.notify_one();
+        thread_.join();
+        DeliverFrame();
+    }
+
+    NotificationDispatcher(const NotificationDispatcher&) = delete;
+    NotificationDispatcher& operator=(const NotificationDispatcher&) = delete;
+
+    // Вызывается из любого потока; не блокируется
+    void Post(IDeferredNotifier* notifier) {
+        posted_.fetch_add(1, std::memory_order_relaxed);
+        queue_.Push(notifier);
+    }
+
+    // Немедленный кадр с ожиданием завершения (для сценариев и тестовых замеров)
+    void Flush() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        uint64_t ticket = ++flushRequested_;
+        wake_.notify_one();
+        frameDone_.wait(lock, [&] { return flushServed_ >= ticket; });
+    }
+
+    uint64_t GetPosted() const { return posted_.load(std::memory_order_relaxed); }
+    uint64_t GetDelivered() const { return delivered_.load(std::memory_order_relaxed); }
+    uint64_t GetFrames() const { return frames_.load(std::memory_order_relaxed); }
+};
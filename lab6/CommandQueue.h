@@ -0,0 +1,281 @@
+#pragma once
+#include "ElevatorMVC.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+// --- Очередь команд и пакетный контроллер ---
+// Шлюз здания шлет пачки событий кнопок из нескольких потоков. События
+// попадают в ограниченную lock-free очередь; вызов на тот же этаж, что и
+// последнее ожидающее в очереди событие, сливается с ним еще до очереди.
+// Более ранние вызовы не сливаются: MovingState::Call меняет цель, и порядок
+// вызовов с событиями между ними определяет итоговое состояние. Единственный поток-
+// владелец забирает события пачками и применяет их к ElevatorModel, поэтому
+// модель меняется только из одного потока. Переполнение очереди не блокирует
+// отправителя — событие отклоняется и учитывается как обратное давление.
+
+struct ControllerEvent {
+    ControllerCommand command;
+    int floor;
+    int64_t enqueuedNs; // Момент постановки в очередь (steady_clock)
+};
+
+inline int64_t SteadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Ограниченная очередь Вьюкова: ячейки с номерами последовательности,
+// емкость — степень двойки; подходит для многих производителей
+template <typename T>
+class BoundedCommandQueue {
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_;
+    alignas(64) std::atomic<size_t> enqueuePos_{0};
+    alignas(64) std::atomic<size_t> dequeuePos_{0};
+
+public:
+    explicit BoundedCommandQueue(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        cells_.reset(new Cell[size]);
+        mask_ = size - 1;
+        for (size_t i = 0; i < size; ++i) cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    // position — номер вставленного элемента (возрастает, не повторяется)
+    bool TryPush(const T& value, size_t* position = nullptr) {
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells_[pos & mask_];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = value;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    if (position) *position = pos;
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // Очередь заполнена
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool TryPop(T& value) {
+        size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells_[pos & mask_];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    value = cell.value;
+                    cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // Очередь пуста
+            } else {
+                pos = dequeuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // true, если элемент с номером position (см. TryPush) — последний в очереди
+    // и еще не извлечен. Сначала проверяется ячейка, затем позиция вставки: она
+    // не убывает, поэтому в момент проверки ячейки была той же
+    bool IsLastQueued(size_t position) const {
+        if (cells_[position & mask_].sequence.load(std::memory_order_acquire) != position + 1) return false;
+        return enqueuePos_.load(std::memory_order_acquire) == position + 1;
+    }
+
+    size_t Capacity() const { return mask_ + 1; }
+    // Приблизительное число элементов в [0, Capacity()]. Сначала читается позиция
+    // извлечения: позиция вставки не меньше нее, поэтому разность не уходит через
+    // ноль. Без общего порядка двух чтений результат все равно ограничивается
+    size_t ApproxSize() const {
+        size_t dequeued = dequeuePos_.load(std::memory_order_acquire);
+        size_t enqueued = enqueuePos_.load(std::memory_order_relaxed);
+        if (enqueued <= dequeued) return 0;
+        return std::min(enqueued - dequeued, Capacity());
+    }
+};
+
+// Снимок метрик обратного давления и задержки
+struct ControllerStats {
+    static constexpr size_t kLatencyBuckets = 40; // Корзина i: задержка < 2^i нс
+
+    uint64_t accepted = 0;
+    uint64_t duplicates = 0; // Вызов, слитый с таким же последним событием очереди
+    uint64_t rejected = 0;   // Очередь заполнена
+    uint64_t applied = 0;
+    uint64_t batches = 0;
+    uint64_t maxDepth = 0;
+    uint64_t latency[kLatencyBuckets] = {};
+
+    double AvgBatch() const { return batches ? static_cast<double>(applied) / batches : 0.0; }
+
+    // Верхняя граница квантиля задержки по корзинам степеней двойки, нс
+    uint64_t LatencyQuantileNs(double q) const {
+        uint64_t total = 0;
+        for (uint64_t bucket : latency) total += bucket;
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kLatencyBuckets; ++i) {
+            seen += latency[i];
+            if (total && seen >= q * total) return uint64_t(1) << i;
+        }
+        return uint64_t(1) << (kLatencyBuckets - 1);
+    }
+};
+
+// Счетчики пишут отправители и владелец, снимок можно брать из любого потока
+struct ControllerMetrics {
+    std::atomic<uint64_t> accepted{0};
+    std::atomic<uint64_t> duplicates{0};
+    std::atomic<uint64_t> rejected{0};
+    std::atomic<uint64_t> applied{0};
+    std::atomic<uint64_t> batches{0};
+    std::atomic<uint64_t> maxDepth{0};
+    std::atomic<uint64_t> latency[ControllerStats::kLatencyBuckets] = {};
+
+    ControllerStats Snapshot() const {
+        ControllerStats stats;
+        stats.accepted = accepted.load(std::memory_order_relaxed);
+        stats.duplicates = duplicates.load(std::memory_order_relaxed);
+        stats.rejected = rejected.load(std::memory_order_relaxed);
+        stats.applied = applied.load(std::memory_order_relaxed);
+        stats.batches = batches.load(std::memory_order_relaxed);
+        stats.maxDepth = maxDepth.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < ControllerStats::kLatencyBuckets; ++i) {
+            stats.latency[i] = latency[i].load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+};
+
+// --- Контроллер с очередью: тот же интерфейс Handle*, что у ElevatorController ---
+class QueuedElevatorController {
+private:
+    static constexpr int kMaxFloor = 255;
+    static constexpr uint64_t kFloorBits = 8;
+    static constexpr uint64_t kFloorMask = (uint64_t(1) << kFloorBits) - 1;
+    static_assert(kMaxFloor <= static_cast<int>(kFloorMask), "Floor must fit into kFloorBits");
+
+    ElevatorModel* model_;
+    BoundedCommandQueue<ControllerEvent> queue_;
+    size_t batchSize_;
+    ControllerMetrics metrics_;
+    // Вызов с наибольшим номером в очереди: (номер + 1) << kFloorBits | этаж; 0 — не было
+    std::atomic<uint64_t> lastCall_{0};
+    std::atomic<bool> running_{true};
+    std::thread owner_;
+
+    void Apply(const ControllerEvent& event) {
+        switch (event.command) {
+        case ControllerCommand::Call: model_->Call(event.floor); break;
+        case ControllerCommand::Load: model_->Load(); break;
+        case ControllerCommand::Unload: model_->Unload(); break;
+        case ControllerCommand::Emergency: model_->Emergency(); break;
+        case ControllerCommand::PowerLoss: model_->PowerLoss(); break;
+        case ControllerCommand::PowerRestore: model_->RestorePower(); break;
+        case ControllerCommand::Arrival: model_->Unload(); break; // Moving -> Standing
+        }
+    }
+
+    void OwnerLoop() {
+        ControllerEvent event;
+        int idle = 0;
+        while (true) {
+            size_t count = 0;
+            while (count < batchSize_ && queue_.TryPop(event)) {
+                Apply(event);
+                int64_t latency = SteadyNowNs() - event.enqueuedNs;
+                size_t bucket = 0;
+                while (bucket + 1 < ControllerStats::kLatencyBuckets && (int64_t(1) << bucket) <= latency) ++bucket;
+                metrics_.latency[bucket].fetch_add(1, std::memory_order_relaxed);
+                ++count;
+            }
+            if (count) {
+                metrics_.applied.fetch_add(count, std::memory_order_relaxed);
+                metrics_.batches.fetch_add(1, std::memory_order_relaxed);
+                idle = 0;
+                continue;
+            }
+            if (!running_.load(std::memory_order_acquire)) break;
+            // Пустая очередь: сначала уступаем процессор, затем короткий сон
+            if (++idle < 64) std::this_thread::yield();
+            else std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+
+    bool Submit(ControllerCommand command, int floor = 0) {
+        if (command == ControllerCommand::Call) {
+            if (floor < 0 || floor > kMaxFloor) return false;
+            // Повтор последнего события очереди: второй такой же вызов подряд состояние не меняет
+            uint64_t last = lastCall_.load(std::memory_order_acquire);
+            if (last && static_cast<int>(last & kFloorMask) == floor && queue_.IsLastQueued((last >> kFloorBits) - 1)) {
+                metrics_.duplicates.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        size_t position;
+        if (!queue_.TryPush({command, floor, SteadyNowNs()}, &position)) {
+            metrics_.rejected.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (command == ControllerCommand::Call) {
+            // Отправители вставляют параллельно: запись только вперед по номеру
+            uint64_t call = (static_cast<uint64_t>(position) + 1) << kFloorBits | static_cast<uint64_t>(floor);
+            uint64_t seen = lastCall_.load(std::memory_order_relaxed);
+            while (seen < call && !lastCall_.compare_exchange_weak(seen, call, std::memory_order_release)) {}
+        }
+        metrics_.accepted.fetch_add(1, std::memory_order_relaxed);
+        uint64_t depth = queue_.ApproxSize();
+        uint64_t seen = metrics_.maxDepth.load(std::memory_order_relaxed);
+        while (depth > seen && !metrics_.maxDepth.compare_exchange_weak(seen, depth, std::memory_order_relaxed)) {}
+        return true;
+    }
+
+public:
+    QueuedElevatorController(ElevatorModel* model, size_t capacity = 4096, size_t batchSize = 256)
+        : model_(model), queue_(capacity), batchSize_(batchSize), owner_([this] { OwnerLoop(); }) {}
+
+    // Оставшиеся события применяются до остановки владельца
+    ~QueuedElevatorController() {
+        running_.store(false, std::memory_order_release);
+        owner_.join();
+    }
+
+    QueuedElevatorController(const QueuedElevatorController&) = delete;
+    QueuedElevatorController& operator=(const QueuedElevatorController&) = delete;
+
+    // false — событие отклонено (очередь заполнена); дубликат вызова считается принятым
+    bool HandleCallButton(int floor) { return Submit(ControllerCommand::Call, floor); }
+    bool HandleLoadEvent() { return Submit(ControllerCommand::Load); }
+    bool HandleUnloadEvent() { return Submit(ControllerCommand::Unload); }
+    bool HandleEmergency() { return Submit(ControllerCommand::Emergency); }
+    bool HandlePowerLoss() { return Submit(ControllerCommand::PowerLoss); }
+    bool HandlePowerRestore() { return Submit(ControllerCommand::PowerRestore); }
+    bool SimulateArrival() { return Submit(ControllerCommand::Arrival); }
+
+    // Ожидание, пока владелец применит все принятые события
+    void Drain() const {
+        while (metrics_.applied.load(std::memory_order_acquire) < metrics_.accepted.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+
+    ControllerStats GetStats() const { return metrics_.Snapshot(); }
+    size_t GetQueueDepth() const { return queue_.ApproxSize(); }
+    size_t GetCapacity() const { return queue_.Capacity(); }
+};
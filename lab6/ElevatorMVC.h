@@ -5,6 +5,12 @@
 #include <memory>
 #include <algorithm>
 #include <map>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include "AsyncNotifier.h"
+#include "ObserverRegistry.h"
+#include "RenderFrames.h"
 
 // Предварительное объявление классов
 class Observer;
@@ -13,28 +19,111 @@ class IElevatorState;
 
 // --- 0. Паттерн Наблюдатель (Observer) - Основа связи View-Model ---
 
+// Поля модели, по которым возможна подписка (битовая маска)
+enum ModelField : uint8_t {
+    kFieldFloor = 1 << 0,
+    kFieldState = 1 << 1,
+    kFieldOverload = 1 << 2,
+    kAllFields = kFieldFloor | kFieldState | kFieldOverload
+};
+
+// Набор изменений с момента предыдущего оповещения: значения "до" и "после"
+// заполнены только для полей из fields
+struct ModelChange {
+    uint8_t fields = 0;
+    int floorBefore = 0, floorAfter = 0;
+    IElevatorState* stateBefore = nullptr;
+    IElevatorState* stateAfter = nullptr;
+    bool overloadBefore = false, overloadAfter = false;
+
+    bool Has(ModelField field) const { return (fields & field) != 0; }
+};
+
 class Observer {
 public:
     virtual ~Observer() = default;
     // Метод, вызываемый Моделью при изменении данных
     virtual void update() = 0;
+    // Поля, изменения которых нужны наблюдателю; остальные оповещения пропускаются
+    virtual uint8_t GetFieldMask() const { return kAllFields; }
+    // Типизированное оповещение; по умолчанию — полная перерисовка через update()
+    virtual void onChange(const ModelChange& /*change*/) { update(); }
 };
 
-class Observable {
+class Observable : public IDeferredNotifier {
 protected:
-    std::vector<Observer*> observers_;
+    ObserverRegistry<Observer> observers_;
+    // Режим доставки: nullptr — синхронно, иначе — через поток диспетчера
+    NotificationDispatcher* dispatcher_ = nullptr;
+    std::atomic<bool> dirty_{false};
+    std::atomic<uint64_t> notifyRequests_{0};
+    std::atomic<uint64_t> delivered_{0}; // Вызовы onChange
+    std::atomic<uint64_t> skipped_{0};   // Наблюдатели, пропущенные по маске полей
+
+    // Накопленные изменения забираются при доставке; по умолчанию — "изменилось все"
+    virtual ModelChange TakePendingChange() {
+        ModelChange change;
+        change.fields = kAllFields;
+        return change;
+    }
 public:
-    void AddObserver(Observer *observer) {
-        observers_.push_back(observer);
+    SubscriptionHandle AddObserver(Observer *observer) {
+        SubscriptionHandle handle = observers_.Add(observer);
         std::cout << "[Observable] Observer subscribed." << std::endl;
+        return handle;
     }
+
+    // Вне оповещения: после возврата наблюдатель больше не вызывается и его можно удалять.
+    // Во время оповещения допустима, но не ждет вызовов на других потоках:
+    // самоотписывающийся наблюдатель удаляется через RetireObserver
+    bool RemoveObserver(SubscriptionHandle handle) { return observers_.Remove(handle); }
+
+    // Отписка с отложенным освобождением (dispose — когда наблюдатель уже не вызывается)
+    bool RetireObserver(SubscriptionHandle handle, std::function<void()> dispose) {
+        return observers_.Retire(handle, std::move(dispose));
+    }
+
+    // Выполняет отложенные освобождения; вызывается вне оповещения
+    bool SynchronizeObservers() { return observers_.Synchronize(); }
+
+    size_t GetObserverCount() const { return observers_.Size(); }
+
+    // Асинхронный режим с объединением: диспетчер должен быть разрушен раньше модели
+    void SetDispatcher(NotificationDispatcher* dispatcher) { dispatcher_ = dispatcher; }
+
     void NotifyUpdate() {
-        std::cout << "\n[Model] Notifying all Views about data change..." << std::endl;
-        for (Observer* obs : observers_) {
-            obs->update();
+        notifyRequests_.fetch_add(1, std::memory_order_relaxed);
+        if (dispatcher_) {
+            // Модель помечается "грязной"; изменения до ближайшего кадра дают одно оповещение
+            if (!dirty_.exchange(true, std::memory_order_acq_rel)) dispatcher_->Post(this);
+            return;
         }
+        Deliver();
+    }
+
+    // Флаг сбрасывается до обхода: изменения во время доставки попадут в следующий кадр.
+    // Пустой набор изменений (значение вернулось к прежнему) никого не оповещает
+    void Deliver() override {
+        dirty_.store(false, std::memory_order_release);
+        ModelChange change = TakePendingChange();
+        if (change.fields == 0) return;
+        std::cout << "\n[Model] Notifying all Views about data change..." << std::endl;
+        uint64_t delivered = 0, skipped = 0;
+        observers_.ForEach([&](Observer* obs) {
+            if (obs->GetFieldMask() & change.fields) {
+                obs->onChange(change);
+                ++delivered;
+            } else {
+                ++skipped;
+            }
+        });
+        delivered_.fetch_add(delivered, std::memory_order_relaxed);
+        skipped_.fetch_add(skipped, std::memory_order_relaxed);
     }
-    // Удаление наблюдателя опущено для краткости ЛР
+
+    uint64_t GetNotifyRequests() const { return notifyRequests_.load(std::memory_order_relaxed); }
+    uint64_t GetDeliveredChanges() const { return delivered_.load(std::memory_order_relaxed); }
+    uint64_t GetSkippedChanges() const { return skipped_.load(std::memory_order_relaxed); }
 };
 
 // --- 1. Интерфейс Состояния (State Interface) ---
@@ -60,51 +149,138 @@ IElevatorState* GetOverloadedState();
 IElevatorState* GetNoPowerState();
 IElevatorState* GetMalfunctionState();
 
+// Команды контроллера (триггеры модели)
+enum class ControllerCommand : uint8_t { Call, Load, Unload, Emergency, PowerLoss, PowerRestore, Arrival };
+
+// Журнал модели: триггеры и каждое изменение полей в порядке применения.
+// Вызывается синхронно из потока, который меняет модель
+class IModelJournal {
+public:
+    virtual ~IModelJournal() = default;
+    virtual void OnCommand(ControllerCommand command, int floor) = 0;
+    virtual void OnTransition(const ElevatorSnapshot& before, const ElevatorSnapshot& after) = 0;
+};
+
 
 // --- 2. Модель (Model) - Контекст для Состояния и Observable ---
 
 class ElevatorModel : public Observable {
 private:
-    std::unique_ptr<IElevatorState> state_;
-    int currentFloor_ = 1;
-    bool isOverloaded_ = false;
+    // Состояния — синглтоны, модель ими не владеет (как в lab5: обычный указатель).
+    // Поля атомарны: в асинхронном режиме представления читают их из потока доставки
+    std::atomic<IElevatorState*> state_;
+    std::atomic<int> currentFloor_{1};
+    std::atomic<bool> isOverloaded_{false};
+
+    // Изменения с момента последнего оповещения. Мьютекс держится только на время
+    // копирования набора, доставка представлениям идет без него
+    std::mutex changeMutex_;
+    ModelChange pending_;
+
+    template <typename Record>
+    void RecordChange(ModelField field, Record record) {
+        std::lock_guard<std::mutex> lock(changeMutex_);
+        record(pending_, (pending_.fields & field) == 0);
+        pending_.fields |= field;
+    }
+
+    // Снимок для цикла отрисовки; пишет только поток контроллера
+    Seqlock<ElevatorSnapshot> snapshot_;
+    ElevatorSnapshot published_;
+    IModelJournal* journal_ = nullptr;
+
+    void PublishSnapshot() {
+        ElevatorSnapshot snapshot;
+        snapshot.version = published_.version + 1;
+        snapshot.state = state_.load(std::memory_order_relaxed);
+        snapshot.floor = currentFloor_.load(std::memory_order_relaxed);
+        snapshot.overloaded = isOverloaded_.load(std::memory_order_relaxed);
+        snapshot_.Store(snapshot);
+        if (journal_) journal_->OnTransition(published_, snapshot);
+        published_ = snapshot;
+    }
+
+    void Journal(ControllerCommand command, int floor = 0) {
+        if (journal_) journal_->OnCommand(command, floor);
+    }
+
+    // Поля, вернувшиеся к исходному значению, исключаются из набора
+    ModelChange TakePendingChange() override {
+        ModelChange change;
+        {
+            std::lock_guard<std::mutex> lock(changeMutex_);
+            change = pending_;
+            pending_.fields = 0;
+        }
+        if (change.floorBefore == change.floorAfter) change.fields &= ~kFieldFloor;
+        if (change.stateBefore == change.stateAfter) change.fields &= ~kFieldState;
+        if (change.overloadBefore == change.overloadAfter) change.fields &= ~kFieldOverload;
+        return change;
+    }
     
 public:
     // Конструктор инициализирует начальное состояние
-    ElevatorModel(std::unique_ptr<IElevatorState> initialState) : currentFloor_(1) {
-        this->state_ = std::move(initialState);
-        std::cout << "Model initialized. Current Floor: " << currentFloor_ << ", State: " << state_->GetName() << std::endl;
+    explicit ElevatorModel(IElevatorState* initialState) : currentFloor_(1) {
+        this->state_ = initialState;
+        PublishSnapshot();
+        std::cout << "Model initialized. Current Floor: " << currentFloor_ << ", State: " << state_.load()->GetName() << std::endl;
     }
 
     // Метод для смены состояния (вызывается из Concrete States)
-    void ChangeState(std::unique_ptr<IElevatorState> newState) {
-        std::cout << "Context: Changing state from " << state_->GetName() << " to " << newState->GetName() << std::endl;
-        state_ = std::move(newState);
+    void ChangeState(IElevatorState* newState) {
+        std::cout << "Context: Changing state from " << state_.load()->GetName() << " to " << newState->GetName() << std::endl;
+        IElevatorState* previous = state_.exchange(newState);
+        RecordChange(kFieldState, [&](ModelChange& c, bool first) {
+            if (first) c.stateBefore = previous;
+            c.stateAfter = newState;
+        });
+        PublishSnapshot();
         // Ключевой момент MVC: оповещаем Представления после изменения Модели
         NotifyUpdate();
     }
 
     // --- Геттеры для View ---
-    std::string GetCurrentStateName() const { return state_->GetName(); }
+    std::string GetCurrentStateName() const { return state_.load()->GetName(); }
     int GetFloor() const { return currentFloor_; }
     bool IsOverloaded() const { return isOverloaded_; }
+    // Согласованный снимок всех полей (без блокировок, из любого потока)
+    ElevatorSnapshot GetSnapshot() const { return snapshot_.Load(); }
+
+    // Журнал событий (nullptr — отключен); подключается, пока модель не меняется
+    void SetJournal(IModelJournal* journal) { journal_ = journal; }
 
     // --- Сеттеры для State/Controller ---
-    void SetFloor(int floor) { currentFloor_ = floor; }
+    void SetFloor(int floor) {
+        int previous = currentFloor_.exchange(floor);
+        RecordChange(kFieldFloor, [&](ModelChange& c, bool first) {
+            if (first) c.floorBefore = previous;
+            c.floorAfter = floor;
+        });
+        PublishSnapshot();
+    }
     void SetOverloaded(bool isOverloaded) { 
         if (isOverloaded_ != isOverloaded) {
             isOverloaded_ = isOverloaded; 
+            RecordChange(kFieldOverload, [&](ModelChange& c, bool first) {
+                if (first) c.overloadBefore = !isOverloaded;
+                c.overloadAfter = isOverloaded;
+            });
+            PublishSnapshot();
             // Оповещаем, если меняется только флаг (без смены состояния)
             NotifyUpdate();
         }
     }
 
     // --- Операции (триггеры, вызываемые Контроллером) ---
-    void Call(int floor) { state_->Call(this, floor); }
-    void Load() { state_->Load(this); }
-    void Unload() { state_->Unload(this); }
-    void RestorePower() { state_->RestorePower(this); }
-    void Emergency() { state_->Emergency(this); }
+    void Call(int floor) { Journal(ControllerCommand::Call, floor); state_.load()->Call(this, floor); }
+    void Load() { Journal(ControllerCommand::Load); state_.load()->Load(this); }
+    void Unload() { Journal(ControllerCommand::Unload); state_.load()->Unload(this); }
+    void RestorePower() { Journal(ControllerCommand::PowerRestore); state_.load()->RestorePower(this); }
+    void Emergency() { Journal(ControllerCommand::Emergency); state_.load()->Emergency(this); }
+    void PowerLoss() {
+        Journal(ControllerCommand::PowerLoss);
+        ChangeState(GetNoPowerState());
+    }
 };
 
 // --- 3. Конкретные Состояния (Concrete States) - Используют ElevatorModel* как контекст ---
@@ -119,24 +295,25 @@ public:
         }
         if (model->IsOverloaded()) {
             std::cout << "Standing: Cannot move, elevator is overloaded." << std::endl;
-            model->ChangeState(std::unique_ptr<IElevatorState>(GetOverloadedState()));
+            model->ChangeState(GetOverloadedState());
             return;
         }
         std::cout << "Standing: Moving from floor " << model->GetFloor() << " to " << floor << "." << std::endl;
-        model->ChangeState(std::unique_ptr<IElevatorState>(GetMovingState()));
+        // Цель записывается до смены состояния: одно оповещение несет и этаж, и состояние
         model->SetFloor(floor);
+        model->ChangeState(GetMovingState());
     }
     void Load(ElevatorModel* model) override {
         std::cout << "Standing: Loading passengers... (Simulating overload)" << std::endl;
         model->SetOverloaded(true);
-        model->ChangeState(std::unique_ptr<IElevatorState>(GetOverloadedState()));
+        model->ChangeState(GetOverloadedState());
     }
     void Unload(ElevatorModel* model) override {
         std::cout << "Standing: Unloading completed. Doors closed." << std::endl;
     }
     void RestorePower(ElevatorModel* model) override { /* No op */ }
     void Emergency(ElevatorModel* model) override {
-        model->ChangeState(std::unique_ptr<IElevatorState>(GetMalfunctionState()));
+        model->ChangeState(GetMalfunctionState());
     }
 };
 
@@ -151,11 +328,11 @@ public:
     void Load(ElevatorModel* model) override { std::cout << "Moving: Cannot load while moving." << std::endl; }
     void Unload(ElevatorModel* model) override { 
         std::cout << "Moving: Reached floor. Stopping." << std::endl;
-        model->ChangeState(std::unique_ptr<IElevatorState>(GetStandingState()));
+        model->ChangeState(GetStandingState());
     }
     void RestorePower(ElevatorModel* model) override { /* No op */ }
     void Emergency(ElevatorModel* model) override {
-        model->ChangeState(std::unique_ptr<IElevatorState>(GetMalfunctionState()));
+        model->ChangeState(GetMalfunctionState());
     }
 };
 
@@ -171,12 +348,12 @@ public:
     void Unload(ElevatorModel* model) override {
         // После разгрузки (если перегрузка устранена), переходим в Standing
         model->SetOverloaded(false); // Сброс флага и оповещение
-        model->ChangeState(std::unique_ptr<IElevatorState>(GetStandingState()));
+        model->ChangeState(GetStandingState());
         std::cout << "Overloaded: Weight reduced. State restored to Standing." << std::endl;
     }
     void RestorePower(ElevatorModel* model) override { /* No op */ }
     void Emergency(ElevatorModel* model) override {
-        model->ChangeState(std::unique_ptr<IElevatorState>(GetMalfunctionState()));
+        model->ChangeState(GetMalfunctionState());
     }
 };
 
@@ -189,7 +366,7 @@ public:
     void Load(ElevatorModel* model) override { /* No op */ }
     void Unload(ElevatorModel* model) override { /* No op */ }
     void RestorePower(ElevatorModel* model) override {
-        model->ChangeState(std::unique_ptr<IElevatorState>(GetStandingState()));
+        model->ChangeState(GetStandingState());
         std::cout << "NoPower: Power restored! Elevator is now Standing." << std::endl;
     }
     void Emergency(ElevatorModel* model) override { /* No op */ }
@@ -220,10 +397,16 @@ IElevatorState* GetMalfunctionState() { static MalfunctionState instance; return
 class AbstractElevatorView : public Observer {
 protected:
     ElevatorModel* model_;
+    SubscriptionHandle subscription_;
 public:
     AbstractElevatorView(ElevatorModel* model) : model_(model) {
-        this->model_->AddObserver(this);
+        this->subscription_ = this->model_->AddObserver(this);
     }
+    // Представление отписывается само: модель не хранит висячих указателей.
+    // Разрушать его изнутри оповещения нельзя (другой поток может быть в update());
+    // для этого — model->RetireObserver(view->GetSubscription(), [view] { delete view; })
+    ~AbstractElevatorView() override { model_->RemoveObserver(subscription_); }
+    SubscriptionHandle GetSubscription() const { return subscription_; }
     virtual void print() = 0;
 };
 
@@ -231,6 +414,9 @@ public:
 class ConsoleView1 : public AbstractElevatorView {
 public:
     ConsoleView1(ElevatorModel* model) : AbstractElevatorView(model) {}
+
+    // Флаг перегрузки не отображается — его изменения не перерисовывают вид
+    uint8_t GetFieldMask() const override { return kFieldFloor | kFieldState; }
     
     void update() override {
         std::cout << "\n--- VIEW 1 UPDATE (Standard) ---" << std::endl;
@@ -260,6 +446,70 @@ public:
     }
 };
 
+// 4.3. Представления для кадров: текст из снимка дописывается в общий буфер кадра
+class IFrameView {
+public:
+    virtual ~IFrameView() = default;
+    virtual void Render(const ElevatorSnapshot& snapshot, FrameBuffer& frame) const = 0;
+};
+
+// Тот же текст, что ConsoleView1::print()
+class StatusFrameView : public IFrameView {
+public:
+    void Render(const ElevatorSnapshot& snapshot, FrameBuffer& frame) const override {
+        frame.Append("  [STATUS] Floor: ").Append(snapshot.floor)
+             .Append(", State: ").Append(snapshot.state->GetName()).Append("\n");
+    }
+};
+
+// Тот же текст, что ConsoleView2::print()
+class DetailedFrameView : public IFrameView {
+public:
+    void Render(const ElevatorSnapshot& snapshot, FrameBuffer& frame) const override {
+        frame.Append("  [LIFT INFO] Current Floor: ").Append(snapshot.floor).Append("\n")
+             .Append("  [LIFT INFO] Operational State: ").Append(snapshot.state->GetName()).Append("\n")
+             .Append("  [LIFT INFO] Overload Alarm: ").Append(snapshot.overloaded ? "ACTIVE" : "OFF").Append("\n");
+    }
+};
+
+// Цикл отрисовки: снимки всех моделей -> задний буфер -> один write на кадр.
+// Буферы меняются местами, передний хранит последний выведенный кадр
+class FrameRenderer {
+private:
+    std::vector<const ElevatorModel*> models_;
+    std::vector<const IFrameView*> views_;
+    FrameBuffer buffers_[2];
+    size_t front_ = 0;
+    bool skipUnchanged_ = false;
+    uint64_t skipped_ = 0;
+
+public:
+    void AddModel(const ElevatorModel* model) { models_.push_back(model); }
+    void AddView(const IFrameView* view) { views_.push_back(view); }
+    // Не выводить кадр, совпадающий с предыдущим
+    void SetSkipUnchanged(bool skip) { skipUnchanged_ = skip; }
+
+    // Возвращает размер кадра в байтах (0 — кадр не изменился и не выводился)
+    size_t RenderFrame(std::ostream& out) {
+        FrameBuffer& back = buffers_[front_ ^ 1];
+        back.Clear();
+        for (const ElevatorModel* model : models_) {
+            ElevatorSnapshot snapshot = model->GetSnapshot();
+            for (const IFrameView* view : views_) view->Render(snapshot, back);
+        }
+        if (skipUnchanged_ && back.View() == buffers_[front_].View()) {
+            ++skipped_;
+            return 0;
+        }
+        back.WriteTo(out);
+        front_ ^= 1;
+        return back.Size();
+    }
+
+    std::string_view GetFrontFrame() const { return buffers_[front_].View(); }
+    uint64_t GetSkippedFrames() const { return skipped_; }
+};
+
 // --- 5. Контроллер (Controller) ---
 
 class ElevatorController {
@@ -290,7 +540,7 @@ public:
     
     void HandlePowerLoss() {
         std::cout << "\n[Controller] Power loss event detected." << std::endl;
-        model_->ChangeState(std::unique_ptr<IElevatorState>(GetNoPowerState()));
+        model_->PowerLoss();
     }
     
     void HandlePowerRestore() {
@@ -0,0 +1,367 @@
+#pragma once
+#include "ElevatorMVC.h"
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// --- Журнал событий лифта ---
+// Модель пишет в журнал каждый триггер контроллера и каждое изменение полей.
+// Журнал — файл только для дозаписи: заголовок и записи фиксированного размера
+// (32 байта), поэтому позиция записи вычисляется без разбора файла. Через каждые
+// snapshotInterval записей перед очередной командой пишется снимок модели.
+// Чтение идет через mmap: состояние на любой момент — последний переход или
+// снимок до него; повторное выполнение — от ближайшего снимка через ElevatorModel.
+
+enum LoggedState : uint8_t { kStateUnknown, kStateStanding, kStateMoving, kStateOverloaded, kStateNoPower, kStateMalfunction };
+
+inline uint8_t StateToId(IElevatorState* state) {
+    if (state == GetStandingState()) return kStateStanding;
+    if (state == GetMovingState()) return kStateMoving;
+    if (state == GetOverloadedState()) return kStateOverloaded;
+    if (state == GetNoPowerState()) return kStateNoPower;
+    if (state == GetMalfunctionState()) return kStateMalfunction;
+    return kStateUnknown;
+}
+
+inline IElevatorState* StateFromId(uint8_t id) {
+    switch (id) {
+    case kStateStanding: return GetStandingState();
+    case kStateMoving: return GetMovingState();
+    case kStateOverloaded: return GetOverloadedState();
+    case kStateNoPower: return GetNoPowerState();
+    case kStateMalfunction: return GetMalfunctionState();
+    default: return nullptr;
+    }
+}
+
+inline const char* CommandName(ControllerCommand command) {
+    switch (command) {
+    case ControllerCommand::Call: return "Call";
+    case ControllerCommand::Load: return "Load";
+    case ControllerCommand::Unload: return "Unload";
+    case ControllerCommand::Emergency: return "Emergency";
+    case ControllerCommand::PowerLoss: return "PowerLoss";
+    case ControllerCommand::PowerRestore: return "PowerRestore";
+    case ControllerCommand::Arrival: return "Arrival";
+    }
+    return "Unknown";
+}
+
+enum LogRecordKind : uint8_t { kRecordCommand = 1, kRecordTransition = 2, kRecordSnapshot = 3 };
+
+struct LogRecord {
+    uint64_t timestampNs; // system_clock; в пределах журнала не убывает
+    uint64_t sequence;
+    uint8_t kind;
+    uint8_t command;      // ControllerCommand (kRecordCommand)
+    uint8_t stateBefore;  // LoggedState до перехода (kRecordTransition)
+    uint8_t state;        // LoggedState после перехода или в снимке
+    int32_t floor;        // Аргумент команды либо этаж после перехода
+    uint8_t overloaded;
+    uint8_t fields;       // Изменившиеся поля ModelField (kRecordTransition)
+    uint16_t reserved;
+    uint32_t reserved2;
+};
+static_assert(sizeof(LogRecord) == 32, "LogRecord must stay 32 bytes");
+
+struct LogHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t snapshotInterval;
+    uint32_t reserved[3];
+};
+static_assert(sizeof(LogHeader) == sizeof(LogRecord), "Header keeps records aligned");
+
+inline constexpr char kLogMagic[8] = {'E', 'L', 'E', 'V', 'L', 'O', 'G', '1'};
+
+inline std::runtime_error LogError(const std::string& what, const std::string& path) {
+    return std::runtime_error(what + " '" + path + "': " + std::strerror(errno));
+}
+
+// Писатель: подключается к модели как журнал; записи копятся в буфере и уходят
+// в файл одним write. Не потокобезопасен — вызывается из потока, меняющего модель
+class EventLog : public IModelJournal {
+private:
+    ElevatorModel* model_;
+    int fd_ = -1;
+    std::string path_;
+    uint32_t snapshotInterval_;
+    std::vector<LogRecord> buffer_;
+    size_t bufferLimit_;
+    uint64_t sequence_ = 0;      // Записей в журнале, включая буфер
+    uint64_t sinceSnapshot_ = 0;
+    uint64_t lastTimestamp_ = 0;
+
+    uint64_t Now() {
+        uint64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        lastTimestamp_ = std::max(lastTimestamp_, now);
+        return lastTimestamp_;
+    }
+
+    LogRecord& Append(LogRecordKind kind) {
+        if (buffer_.size() >= bufferLimit_) Flush();
+        buffer_.push_back(LogRecord{});
+        LogRecord& record = buffer_.back();
+        record.timestampNs = Now();
+        record.sequence = sequence_++;
+        record.kind = kind;
+        ++sinceSnapshot_;
+        return record;
+    }
+
+    void AppendSnapshot() {
+        ElevatorSnapshot snapshot = model_->GetSnapshot();
+        LogRecord& record = Append(kRecordSnapshot);
+        record.state = StateToId(snapshot.state);
+        record.floor = snapshot.floor;
+        record.overloaded = snapshot.overloaded;
+        sinceSnapshot_ = 0;
+    }
+
+    void WriteAll(const void* data, size_t size) {
+        const char* bytes = static_cast<const char*>(data);
+        while (size > 0) {
+            ssize_t written = ::write(fd_, bytes, size);
+            if (written < 0) {
+                if (errno == EINTR) continue;
+                throw LogError("Cannot write event log", path_);
+            }
+            bytes += written;
+            size -= static_cast<size_t>(written);
+        }
+    }
+
+public:
+    // Существующий журнал дописывается, если совпадает формат
+    EventLog(const std::string& path, ElevatorModel* model, uint32_t snapshotInterval = 1024, size_t bufferRecords = 4096)
+        : model_(model), path_(path), snapshotInterval_(snapshotInterval), bufferLimit_(bufferRecords) {
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+        if (fd_ < 0) throw LogError("Cannot open event log", path);
+        struct stat info;
+        if (::fstat(fd_, &info) != 0) {
+            ::close(fd_);
+            throw LogError("Cannot stat event log", path);
+        }
+        if (info.st_size == 0) {
+            LogHeader header{};
+            std::memcpy(header.magic, kLogMagic, sizeof(kLogMagic));
+            header.version = 1;
+            header.recordSize = sizeof(LogRecord);
+            header.snapshotInterval = snapshotInterval;
+            WriteAll(&header, sizeof(header));
+        } else {
+            LogHeader header{};
+            if (::pread(fd_, &header, sizeof(header), 0) != sizeof(header) ||
+                std::memcmp(header.magic, kLogMagic, sizeof(kLogMagic)) != 0 || header.recordSize != sizeof(LogRecord)) {
+                ::close(fd_);
+                throw std::runtime_error("Not an elevator event log: '" + path + "'");
+            }
+            // Неполная последняя запись (обрыв при сбое) отрезается, чтобы не сдвинуть новые
+            sequence_ = (info.st_size - sizeof(LogHeader)) / sizeof(LogRecord);
+            off_t whole = static_cast<off_t>(sizeof(LogHeader) + sequence_ * sizeof(LogRecord));
+            if (whole != info.st_size && ::ftruncate(fd_, whole) != 0) {
+                ::close(fd_);
+                throw LogError("Cannot truncate event log", path);
+            }
+            // Метки времени продолжаются от последней записи: если часы после
+            // перезапуска отстают, журнал все равно остается упорядоченным по времени
+            LogRecord last{};
+            if (sequence_ > 0) {
+                if (::pread(fd_, &last, sizeof(last), whole - static_cast<off_t>(sizeof(LogRecord))) != sizeof(last)) {
+                    ::close(fd_);
+                    throw LogError("Cannot read event log", path);
+                }
+                lastTimestamp_ = last.timestampNs;
+            }
+        }
+        buffer_.reserve(bufferLimit_);
+        AppendSnapshot();
+        model_->SetJournal(this);
+    }
+
+    ~EventLog() override {
+        model_->SetJournal(nullptr);
+        try {
+            Flush();
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+        }
+        ::close(fd_);
+    }
+
+    EventLog(const EventLog&) = delete;
+    EventLog& operator=(const EventLog&) = delete;
+
+    // Снимок пишется перед командой, а не между командой и ее переходами
+    void OnCommand(ControllerCommand command, int floor) override {
+        if (sinceSnapshot_ >= snapshotInterval_) AppendSnapshot();
+        LogRecord& record = Append(kRecordCommand);
+        record.command = static_cast<uint8_t>(command);
+        record.floor = floor;
+    }
+
+    void OnTransition(const ElevatorSnapshot& before, const ElevatorSnapshot& after) override {
+        LogRecord& record = Append(kRecordTransition);
+        record.stateBefore = StateToId(before.state);
+        record.state = StateToId(after.state);
+        record.floor = after.floor;
+        record.overloaded = after.overloaded;
+        record.fields = (before.floor != after.floor ? kFieldFloor : 0) |
+                        (before.state != after.state ? kFieldState : 0) |
+                        (before.overloaded != after.overloaded ? kFieldOverload : 0);
+    }
+
+    void Flush() {
+        if (buffer_.empty()) return;
+        WriteAll(buffer_.data(), buffer_.size() * sizeof(LogRecord));
+        buffer_.clear();
+    }
+
+    uint64_t GetRecordCount() const { return sequence_; }
+};
+
+// Состояние модели, восстановленное по журналу
+struct LoggedModelState {
+    uint8_t state = kStateUnknown;
+    int32_t floor = 0;
+    bool overloaded = false;
+    uint64_t sequence = 0;    // Запись, из которой взято состояние
+    uint64_t timestampNs = 0;
+};
+
+// Читатель: весь файл отображается в память только для чтения
+class EventLogReader {
+private:
+    int fd_ = -1;
+    void* mapping_ = nullptr;
+    size_t mappedSize_ = 0;
+    const LogRecord* records_ = nullptr;
+    size_t count_ = 0;
+    uint32_t snapshotInterval_ = 0;
+
+public:
+    explicit EventLogReader(const std::string& path) {
+        fd_ = ::open(path.c_str(), O_RDONLY);
+        if (fd_ < 0) throw LogError("Cannot open event log", path);
+        struct stat info;
+        if (::fstat(fd_, &info) != 0) {
+            ::close(fd_);
+            throw LogError("Cannot stat event log", path);
+        }
+        mappedSize_ = static_cast<size_t>(info.st_size);
+        if (mappedSize_ < sizeof(LogHeader)) {
+            ::close(fd_);
+            throw std::runtime_error("Not an elevator event log: '" + path + "'");
+        }
+        mapping_ = ::mmap(nullptr, mappedSize_, PROT_READ, MAP_PRIVATE, fd_, 0);
+        if (mapping_ == MAP_FAILED) {
+            ::close(fd_);
+            throw LogError("Cannot map event log", path);
+        }
+        const LogHeader* header = static_cast<const LogHeader*>(mapping_);
+        if (std::memcmp(header->magic, kLogMagic, sizeof(kLogMagic)) != 0 || header->recordSize != sizeof(LogRecord)) {
+            ::munmap(mapping_, mappedSize_);
+            ::close(fd_);
+            throw std::runtime_error("Not an elevator event log: '" + path + "'");
+        }
+        ::madvise(mapping_, mappedSize_, MADV_SEQUENTIAL);
+        snapshotInterval_ = header->snapshotInterval;
+        records_ = reinterpret_cast<const LogRecord*>(header + 1);
+        count_ = (mappedSize_ - sizeof(LogHeader)) / sizeof(LogRecord);
+    }
+
+    ~EventLogReader() {
+        ::munmap(mapping_, mappedSize_);
+        ::close(fd_);
+    }
+
+    EventLogReader(const EventLogReader&) = delete;
+    EventLogReader& operator=(const EventLogReader&) = delete;
+
+    size_t Size() const { return count_; }
+    size_t GetFileSize() const { return mappedSize_; }
+    uint32_t GetSnapshotInterval() const { return snapshotInterval_; }
+    const LogRecord& operator[](size_t index) const { return records_[index]; }
+    const LogRecord* begin() const { return records_; }
+    const LogRecord* end() const { return records_ + count_; }
+
+    // Число записей с меткой времени не позже timestampNs
+    size_t CountUntil(uint64_t timestampNs) const {
+        return std::upper_bound(begin(), end(), timestampNs,
+                                [](uint64_t t, const LogRecord& r) { return t < r.timestampNs; }) - begin();
+    }
+
+    // Индекс последнего снимка среди первых count записей (count_, если его нет)
+    size_t SnapshotBefore(size_t count) const {
+        for (size_t i = std::min(count, count_); i-- > 0;) {
+            if (records_[i].kind == kRecordSnapshot) return i;
+        }
+        return count_;
+    }
+
+    // Состояние после первых count записей: ближайший назад переход или снимок.
+    // Просмотр ограничен интервалом снимков
+    LoggedModelState StateAfter(size_t count) const {
+        LoggedModelState result;
+        for (size_t i = std::min(count, count_); i-- > 0;) {
+            const LogRecord& r = records_[i];
+            if (r.kind == kRecordTransition || r.kind == kRecordSnapshot) {
+                result.state = r.state;
+                result.floor = r.floor;
+                result.overloaded = r.overloaded != 0;
+                result.sequence = r.sequence;
+                result.timestampNs = r.timestampNs;
+                break;
+            }
+        }
+        return result;
+    }
+
+    LoggedModelState StateAt(uint64_t timestampNs) const { return StateAfter(CountUntil(timestampNs)); }
+
+    // Применение команд из записей [from, to) к модели; возвращает их число
+    size_t ApplyCommands(ElevatorModel& model, size_t from, size_t to) const {
+        size_t applied = 0;
+        for (size_t i = from; i < std::min(to, count_); ++i) {
+            const LogRecord& r = records_[i];
+            if (r.kind != kRecordCommand) continue;
+            switch (static_cast<ControllerCommand>(r.command)) {
+            case ControllerCommand::Call: model.Call(r.floor); break;
+            case ControllerCommand::Load: model.Load(); break;
+            case ControllerCommand::Unload:
+            case ControllerCommand::Arrival: model.Unload(); break;
+            case ControllerCommand::Emergency: model.Emergency(); break;
+            case ControllerCommand::PowerLoss: model.PowerLoss(); break;
+            case ControllerCommand::PowerRestore: model.RestorePower(); break;
+            }
+            ++applied;
+        }
+        return applied;
+    }
+
+    // Повторное выполнение: модель восстанавливается из ближайшего снимка, затем
+    // к ней применяются команды до позиции count. Возвращает число примененных команд.
+    // Снимок с неизвестным состоянием отклоняется исключением, модель не меняется
+    size_t ReplayInto(ElevatorModel& model, size_t count) const {
+        count = std::min(count, count_);
+        size_t snapshot = SnapshotBefore(count);
+        if (snapshot == count_) return 0;
+        const LogRecord& s = records_[snapshot];
+        IElevatorState* state = StateFromId(s.state);
+        if (!state) {
+            throw std::runtime_error("Corrupt event log: snapshot #" + std::to_string(s.sequence) +
+                                     " has unknown state id " + std::to_string(s.state));
+        }
+        model.SetFloor(s.floor);
+        model.SetOverloaded(s.overloaded != 0);
+        model.ChangeState(state);
+        return ApplyCommands(model, snapshot + 1, count);
+    }
+};
@@ -0,0 +1,214 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// --- Реестр подписчиков с дескрипторами поколений ---
+// Подписчики лежат в слотах фиксированных блоков (адреса стабильны). Подписка
+// берет слот из списка свободных, отписка обнуляет слот и увеличивает его
+// поколение — обе операции O(1). Дескриптор {индекс, поколение} после
+// повторного использования слота становится недействительным.
+// Обход (оповещение) не берет блокировок: слот читается атомарно, пустые
+// пропускаются. Отписка вне обхода этого реестра дожидается обходов, начатых
+// до нее (счетчики читателей по четности эпохи), поэтому после возврата
+// наблюдатель больше не вызывается и его можно удалять.
+// Отписка изнутри обхода этого реестра ждать не может: два оповещающих потока,
+// отписывающих наблюдателей друг у друга, ждали бы друг друга вечно. Такая
+// отписка только снимает наблюдателя со слота — новые обходы его не увидят, но
+// другие потоки могут еще находиться в его вызове. Удалять такого наблюдателя
+// сразу нельзя: для этого есть Retire — освобождение после периода ожидания
+// (выполняется ближайшей отпиской вне обхода, Synchronize или деструктором).
+
+// Обходы, в которых находится текущий поток: цепочка кадров на стеке, по кадру
+// на вызов ForEach; отписка ищет в ней свой реестр
+struct ObserverIterationFrame {
+    const void* registry;
+    ObserverIterationFrame* outer;
+
+    static inline thread_local ObserverIterationFrame* current = nullptr;
+
+    static bool Contains(const void* registry) {
+        for (ObserverIterationFrame* frame = current; frame; frame = frame->outer) {
+            if (frame->registry == registry) return true;
+        }
+        return false;
+    }
+};
+
+struct SubscriptionHandle {
+    static constexpr uint32_t kInvalid = UINT32_MAX;
+    uint32_t index = kInvalid;
+    uint32_t generation = 0;
+
+    bool IsValid() const { return index != kInvalid; }
+};
+
+template <typename T>
+class ObserverRegistry {
+private:
+    static constexpr uint32_t kChunkBits = 10;
+    static constexpr uint32_t kChunkSize = 1u << kChunkBits;
+    static constexpr uint32_t kMaxChunks = 1024;
+    static constexpr uint32_t kNone = UINT32_MAX;
+
+    struct Slot {
+        std::atomic<T*> item{nullptr};
+        uint32_t generation = 0; // Меняется только под writeMutex_
+        uint32_t nextFree = kNone;
+    };
+
+    std::atomic<Slot*> chunks_[kMaxChunks] = {};
+    std::atomic<uint32_t> highWater_{0}; // Число когда-либо выданных слотов
+    std::atomic<uint32_t> size_{0};
+    uint32_t freeHead_ = kNone;
+    std::mutex writeMutex_; // Подписка/отписка между собой; читатели его не берут
+
+    std::atomic<uint64_t> epoch_{0};
+    std::atomic<uint32_t> readers_[2] = {};
+    std::mutex syncMutex_;
+    std::vector<std::function<void()>> retired_; // Под writeMutex_; ждут периода ожидания
+
+    Slot& At(uint32_t index) const {
+        return chunks_[index >> kChunkBits].load(std::memory_order_acquire)[index & (kChunkSize - 1)];
+    }
+
+    // Вход читателя: счетчик четности эпохи, подтвержденный повторным чтением эпохи
+    uint32_t EnterRead() {
+        while (true) {
+            uint64_t epoch = epoch_.load();
+            uint32_t parity = static_cast<uint32_t>(epoch & 1);
+            readers_[parity].fetch_add(1);
+            if (epoch_.load() == epoch) return parity;
+            readers_[parity].fetch_sub(1);
+        }
+    }
+
+    // Ожидание читателей, которые могли увидеть слот до его обнуления. Вызывается
+    // только вне обхода этого реестра, поэтому каждая смена эпохи дожидается всех
+    // читателей предыдущей: после возврата завершены все обходы, начатые раньше.
+    // Отложенные освобождения, накопленные до смены эпохи, после нее безопасны
+    void WaitForReaders() {
+        std::vector<std::function<void()>> ready;
+        {
+            std::lock_guard<std::mutex> lock(writeMutex_);
+            ready.swap(retired_);
+        }
+        {
+            std::lock_guard<std::mutex> lock(syncMutex_);
+            uint64_t epoch = epoch_.fetch_add(1);
+            while (readers_[epoch & 1].load(std::memory_order_acquire) != 0) std::this_thread::yield();
+        }
+        for (auto& dispose : ready) dispose();
+    }
+
+    // Снятие со слота; false — дескриптор устарел
+    bool Unlink(SubscriptionHandle handle) {
+        if (!handle.IsValid() || handle.index >= highWater_.load(std::memory_order_relaxed)) return false;
+        Slot& slot = At(handle.index);
+        if (slot.generation != handle.generation || !slot.item.load(std::memory_order_relaxed)) return false;
+        slot.item.store(nullptr);
+        ++slot.generation;
+        slot.nextFree = freeHead_;
+        freeHead_ = handle.index;
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+public:
+    ObserverRegistry() = default;
+    ObserverRegistry(const ObserverRegistry&) = delete;
+    ObserverRegistry& operator=(const ObserverRegistry&) = delete;
+
+    // Обходов к этому моменту быть не должно: отложенные освобождения выполняются сразу
+    ~ObserverRegistry() {
+        for (auto& dispose : retired_) dispose();
+        for (auto& chunk : chunks_) delete[] chunk.load();
+    }
+
+    SubscriptionHandle Add(T* item) {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        uint32_t index = freeHead_;
+        if (index != kNone) {
+            freeHead_ = At(index).nextFree;
+        } else {
+            index = highWater_.load(std::memory_order_relaxed);
+            if ((index >> kChunkBits) >= kMaxChunks) throw std::length_error("Too many observers");
+            if ((index & (kChunkSize - 1)) == 0) {
+                chunks_[index >> kChunkBits].store(new Slot[kChunkSize], std::memory_order_release);
+            }
+        }
+        Slot& slot = At(index);
+        slot.item.store(item, std::memory_order_release);
+        if (index == highWater_.load(std::memory_order_relaxed)) highWater_.store(index + 1, std::memory_order_release);
+        size_.fetch_add(1, std::memory_order_relaxed);
+        return {index, slot.generation};
+    }
+
+    // false — дескриптор устарел (уже отписан или слот занят другим подписчиком).
+    // Вне обхода: после возврата подписчик больше не вызывается. Изнутри обхода
+    // этого реестра: не ждет, вызовы на других потоках могут еще идти (см. Retire)
+    bool Remove(SubscriptionHandle handle) {
+        {
+            std::lock_guard<std::mutex> lock(writeMutex_);
+            if (!Unlink(handle)) return false;
+        }
+        if (!InIteration()) WaitForReaders();
+        return true;
+    }
+
+    // Отписка с освобождением: dispose (например, удаление подписчика) вызывается,
+    // когда ни один обход уже не может его вызвать. Вне обхода — до возврата, изнутри
+    // обхода (самоотписка) — позже, при ближайшей отписке вне обхода или Synchronize.
+    // При устаревшем дескрипторе dispose не вызывается
+    bool Retire(SubscriptionHandle handle, std::function<void()> dispose) {
+        {
+            std::lock_guard<std::mutex> lock(writeMutex_);
+            if (!Unlink(handle)) return false;
+            retired_.push_back(std::move(dispose));
+        }
+        if (!InIteration()) WaitForReaders();
+        return true;
+    }
+
+    // Ждет обходов, начатых раньше, и выполняет накопленные освобождения;
+    // изнутри обхода этого реестра ничего не делает и возвращает false
+    bool Synchronize() {
+        if (InIteration()) return false;
+        WaitForReaders();
+        return true;
+    }
+
+    // Находится ли текущий поток внутри ForEach этого реестра
+    bool InIteration() const { return ObserverIterationFrame::Contains(this); }
+
+    // Обход без блокировок; подписчики, добавленные во время обхода, могут быть не посещены
+    template <typename Func>
+    void ForEach(Func&& func) {
+        struct ReadGuard {
+            ObserverRegistry& registry;
+            uint32_t parity;
+            ObserverIterationFrame frame;
+            ~ReadGuard() {
+                ObserverIterationFrame::current = frame.outer;
+                registry.readers_[parity].fetch_sub(1, std::memory_order_release);
+            }
+        } guard{*this, EnterRead(), {this, ObserverIterationFrame::current}};
+        ObserverIterationFrame::current = &guard.frame;
+        uint32_t count = highWater_.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < count; ++i) {
+            if (T* item = At(i).item.load(std::memory_order_acquire)) func(item);
+        }
+    }
+
+    size_t Size() const { return size_.load(std::memory_order_relaxed); }
+    size_t PendingDisposals() {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        return retired_.size();
+    }
+    size_t Capacity() const { return static_cast<size_t>(kMaxChunks) * kChunkSize; }
+};
@@ -0,0 +1,101 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// --- Снимки модели и кадры отрисовки ---
+// Модель публикует неизменяемый снимок своих полей через seqlock: писатель
+// (контроллер) не ждет читателей, а читатель (цикл отрисовки) повторяет чтение,
+// если попал на запись. Представления дописывают текст в переиспользуемый буфер
+// кадра, и кадр целиком уходит в поток одним вызовом write.
+
+class IElevatorState;
+
+// Снимок полей ElevatorModel
+struct ElevatorSnapshot {
+    uint64_t version = 0;
+    IElevatorState* state = nullptr; // Синглтон состояния
+    int32_t floor = 1;
+    bool overloaded = false;
+};
+
+// Seqlock для тривиально копируемого T: данные лежат в атомарных словах,
+// поэтому одновременные чтение и запись не являются гонкой данных
+template <typename T>
+class Seqlock {
+    static_assert(std::is_trivially_copyable<T>::value, "Seqlock requires a trivially copyable type");
+    static constexpr size_t kWords = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    std::atomic<uint64_t> sequence_{0}; // Нечетное значение — идет запись
+    std::atomic<uint64_t> words_[kWords] = {};
+
+public:
+    // Единственный писатель
+    void Store(const T& value) {
+        uint64_t raw[kWords] = {};
+        std::memcpy(raw, &value, sizeof(T));
+        uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < kWords; ++i) words_[i].store(raw[i], std::memory_order_relaxed);
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    // Любое число читателей, без блокировок
+    T Load() const {
+        uint64_t raw[kWords];
+        while (true) {
+            uint64_t before = sequence_.load(std::memory_order_acquire);
+            if (before & 1) continue;
+            for (size_t i = 0; i < kWords; ++i) raw[i] = words_[i].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence_.load(std::memory_order_relaxed) == before) break;
+        }
+        T value;
+        std::memcpy(&value, raw, sizeof(T));
+        return value;
+    }
+};
+
+// Переиспользуемый буфер кадра: память выделяется один раз и растет по необходимости
+class FrameBuffer {
+private:
+    std::vector<char> data_;
+    size_t size_ = 0;
+
+    char* Reserve(size_t extra) {
+        if (size_ + extra > data_.size()) data_.resize(std::max(data_.size() * 2, size_ + extra));
+        return data_.data() + size_;
+    }
+
+public:
+    void Clear() { size_ = 0; }
+
+    FrameBuffer& Append(std::string_view text) {
+        std::memcpy(Reserve(text.size()), text.data(), text.size());
+        size_ += text.size();
+        return *this;
+    }
+
+    FrameBuffer& Append(int64_t value) {
+        char* begin = Reserve(24);
+        size_ = std::to_chars(begin, begin + 24, value).ptr - data_.data();
+        return *this;
+    }
+
+    // Весь кадр — один write и один flush
+    void WriteTo(std::ostream& out) const {
+        out.write(data_.data(), static_cast<std::streamsize>(size_));
+        out.flush();
+    }
+
+    std::string_view View() const { return {data_.data(), size_}; }
+    size_t Size() const { return size_; }
+};
@@ -0,0 +1,123 @@
+#include "ElevatorMVC.h"
+#include <chrono>
+#include <cstdlib>
+
+// Медленное представление для замеров: имитирует отрисовку занятым ожиданием
+class SlowView : public AbstractElevatorView {
+private:
+    std::chrono::microseconds renderCost_;
+    std::atomic<uint64_t> updates_{0};
+    int lastFloor_ = 0;
+
+public:
+    SlowView(ElevatorModel* model, std::chrono::microseconds renderCost)
+        : AbstractElevatorView(model), renderCost_(renderCost) {}
+
+    void update() override {
+        print();
+        updates_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void print() override {
+        auto until = std::chrono::steady_clock::now() + renderCost_;
+        lastFloor_ = model_->GetFloor();
+        while (std::chrono::steady_clock::now() < until) {}
+    }
+
+    uint64_t GetUpdates() const { return updates_.load(std::memory_order_relaxed); }
+};
+
+// Последовательность событий контроллера: вызов, прибытие, загрузка, разгрузка
+void DriveController(ElevatorController& controller, int step) {
+    switch (step % 4) {
+    case 0: controller.HandleCallButton(2 + step % 17); break;
+    case 1: controller.SimulateArrival(); break;
+    case 2: controller.HandleLoadEvent(); break;
+    case 3: controller.HandleUnloadEvent(); break;
+    }
+}
+
+struct LatencyReport {
+    double p50, p99, max;
+    uint64_t requests, deliveries, viewUpdates;
+};
+
+// Задержка каждого вызова контроллера при 100 подключенных представлениях
+// (события приходят не чаще одного за interval)
+LatencyReport MeasureLatency(bool async, int events, std::chrono::microseconds renderCost,
+                             std::chrono::microseconds interval) {
+    std::cout.setstate(std::ios::badbit); // Печать контроллера и состояний не входит в замер
+    ElevatorModel model{GetStandingState()};
+    std::vector<std::unique_ptr<SlowView>> views;
+    for (int i = 0; i < 100; ++i) views.push_back(std::make_unique<SlowView>(&model, renderCost));
+    ElevatorController controller(&model);
+
+    std::vector<double> latencies;
+    latencies.reserve(events);
+    LatencyReport report{};
+    {
+        NotificationDispatcher dispatcher;
+        if (async) model.SetDispatcher(&dispatcher);
+        for (int i = 0; i < events; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            auto next = start + interval;
+            DriveController(controller, i);
+            latencies.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+            while (std::chrono::steady_clock::now() < next) {}
+        }
+        dispatcher.Flush();
+        report.deliveries = async ? dispatcher.GetDelivered() : 0;
+    }
+    std::cout.clear();
+
+    std::sort(latencies.begin(), latencies.end());
+    report.p50 = latencies[latencies.size() / 2];
+    report.p99 = latencies[latencies.size() * 99 / 100];
+    report.max = latencies.back();
+    report.requests = model.GetNotifyRequests();
+    for (const auto& view : views) report.viewUpdates += view->GetUpdates();
+    return report;
+}
+
+// Параметры: [событий контроллера] [стоимость отрисовки, мкс]
+int main(int argc, char* argv[]) {
+    std::cout << "--- LR6: MVC with Coalesced Asynchronous Notifications ---" << std::endl;
+
+    // 1. Сценарий: изменения одного события объединяются в одно оповещение за кадр
+    {
+        ElevatorModel elevator{GetStandingState()};
+        ConsoleView1 view1(&elevator);
+        ConsoleView2 view2(&elevator);
+        ElevatorController controller(&elevator);
+        NotificationDispatcher dispatcher;
+        elevator.SetDispatcher(&dispatcher);
+
+        controller.HandleCallButton(5);
+        dispatcher.Flush();
+        controller.SimulateArrival();
+        controller.HandleLoadEvent(); // SetOverloaded и ChangeState — два изменения
+        dispatcher.Flush();
+        controller.HandleUnloadEvent();
+        dispatcher.Flush();
+        std::cout << "\n[Dispatcher] Change notifications: " << elevator.GetNotifyRequests()
+                  << ", deliveries: " << dispatcher.GetDelivered() << std::endl;
+    }
+
+    // 2. Задержка контроллера: синхронные оповещения против асинхронных
+    int events = argc > 1 ? std::atoi(argv[1]) : 2000;
+    std::chrono::microseconds renderCost(argc > 2 ? std::atoi(argv[2]) : 5);
+    std::cout << "\n--- Controller latency (100 views, " << renderCost.count() << " us per render, "
+              << events << " events) ---" << std::endl;
+    std::chrono::microseconds interval(50);
+    LatencyReport sync = MeasureLatency(false, events, renderCost, interval);
+    LatencyReport async = MeasureLatency(true, events, renderCost, interval);
+    std::cout << "[Latency] Synchronous: p50 " << sync.p50 << " us, p99 " << sync.p99 << " us, max " << sync.max
+              << " us; view updates: " << sync.viewUpdates << std::endl;
+    std::cout << "[Latency] Coalesced async: p50 " << async.p50 << " us, p99 " << async.p99 << " us, max " << async.max
+              << " us; view updates: " << async.viewUpdates << std::endl;
+    std::cout << "[Latency] Async notifications: " << async.requests << " requested, " << async.deliveries
+              << " delivered in 16 ms frames (" << static_cast<double>(async.requests) / std::max<uint64_t>(1, async.deliveries)
+              << " changes per delivery)" << std::endl;
+
+    return 0;
+}
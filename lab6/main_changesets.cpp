@@ -0,0 +1,127 @@
+#include "ElevatorMVC.h"
+#include <chrono>
+#include <cstdlib>
+#include <random>
+
+// Табло этажа: подписано только на этаж, выводит переход "до -> после"
+class FloorIndicatorView : public AbstractElevatorView {
+public:
+    FloorIndicatorView(ElevatorModel* model) : AbstractElevatorView(model) {}
+    uint8_t GetFieldMask() const override { return kFieldFloor; }
+    void onChange(const ModelChange& change) override {
+        std::cout << "  [FLOOR INDICATOR] " << change.floorBefore << " -> " << change.floorAfter << std::endl;
+    }
+    void update() override { print(); }
+    void print() override { std::cout << "  [FLOOR INDICATOR] " << model_->GetFloor() << std::endl; }
+};
+
+// Лампа перегрузки: подписана только на флаг перегрузки
+class OverloadLampView : public AbstractElevatorView {
+public:
+    OverloadLampView(ElevatorModel* model) : AbstractElevatorView(model) {}
+    uint8_t GetFieldMask() const override { return kFieldOverload; }
+    void onChange(const ModelChange& change) override {
+        std::cout << "  [OVERLOAD LAMP] " << (change.overloadAfter ? "ON" : "OFF") << std::endl;
+    }
+    void update() override { print(); }
+    void print() override { std::cout << "  [OVERLOAD LAMP] " << (model_->IsOverloaded() ? "ON" : "OFF") << std::endl; }
+};
+
+// Представление для замеров: формирует строку статуса по своим полям
+class RenderCountingView : public AbstractElevatorView {
+private:
+    uint8_t mask_;
+    std::string frame_;
+    uint64_t renders_ = 0;
+
+public:
+    RenderCountingView(ElevatorModel* model, uint8_t mask) : AbstractElevatorView(model), mask_(mask) {}
+    uint8_t GetFieldMask() const override { return mask_; }
+    void update() override { print(); }
+    void print() override {
+        frame_.clear();
+        if (mask_ & kFieldFloor) frame_ += "Floor " + std::to_string(model_->GetFloor()) + ' ';
+        if (mask_ & kFieldState) frame_ += "State " + model_->GetCurrentStateName() + ' ';
+        if (mask_ & kFieldOverload) frame_ += model_->IsOverloaded() ? "Overload ON" : "Overload OFF";
+        ++renders_;
+    }
+    uint64_t GetRenders() const { return renders_; }
+};
+
+// Случайная последовательность событий контроллера
+void DriveRandom(ElevatorController& controller, std::mt19937& rng) {
+    switch (rng() % 6) {
+    case 0: controller.HandleCallButton(1 + static_cast<int>(rng() % 20)); break;
+    case 1: controller.SimulateArrival(); break;
+    case 2: controller.HandleLoadEvent(); break;
+    case 3: controller.HandleUnloadEvent(); break;
+    case 4: controller.HandlePowerLoss(); break;
+    case 5: controller.HandlePowerRestore(); break;
+    }
+}
+
+struct RenderReport {
+    uint64_t notifications, renders;
+    double seconds;
+};
+
+// Все представления подписаны на все поля (fineGrained = false) или на свои подмножества
+RenderReport RunViews(bool fineGrained, size_t viewCount, int events) {
+    std::cout.setstate(std::ios::badbit);
+    ElevatorModel model{GetStandingState()};
+    const uint8_t masks[] = {kFieldFloor, kFieldState, kFieldOverload, kFieldFloor | kFieldState, kAllFields};
+    std::vector<std::unique_ptr<RenderCountingView>> views;
+    for (size_t i = 0; i < viewCount; ++i) {
+        uint32_t mask = fineGrained ? uint32_t(masks[i % 5]) : uint32_t(kAllFields);
+        views.push_back(std::make_unique<RenderCountingView>(&model, static_cast<uint8_t>(mask)));
+    }
+    ElevatorController controller(&model);
+    std::mt19937 rng(17);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < events; ++i) DriveRandom(controller, rng);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout.clear();
+
+    RenderReport report{model.GetNotifyRequests(), 0, seconds};
+    for (const auto& view : views) report.renders += view->GetRenders();
+    return report;
+}
+
+// Параметры: [число представлений] [событий контроллера]
+int main(int argc, char* argv[]) {
+    std::cout << "--- LR6: MVC with Typed Change Sets ---" << std::endl;
+
+    // 1. Представления получают только интересующие их поля со значениями "до" и "после"
+    {
+        ElevatorModel elevator{GetStandingState()};
+        ConsoleView1 view1(&elevator);
+        FloorIndicatorView indicator(&elevator);
+        OverloadLampView lamp(&elevator);
+        ElevatorController controller(&elevator);
+
+        controller.HandleCallButton(7);
+        controller.SimulateArrival();
+        controller.HandleLoadEvent();
+        controller.HandleUnloadEvent();
+        std::cout << "\n[Changes] Delivered: " << elevator.GetDeliveredChanges()
+                  << ", skipped by field mask: " << elevator.GetSkippedChanges() << std::endl;
+    }
+
+    // 2. Лишние перерисовки при большом числе представлений
+    size_t viewCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000;
+    int events = argc > 2 ? std::atoi(argv[2]) : 20000;
+    RenderReport all = RunViews(false, viewCount, events);
+    RenderReport fine = RunViews(true, viewCount, events);
+    // Прежнее поведение: каждое NotifyUpdate перерисовывает каждое представление
+    uint64_t legacy = all.notifications * viewCount;
+
+    std::cout << "\n--- Redundant renders (" << viewCount << " views, " << events << " controller events) ---" << std::endl;
+    std::cout << "[Renders] Whole-model update() on every notification: " << legacy << std::endl;
+    std::cout << "[Renders] All-field views, unchanged values dropped: " << all.renders << " (" << all.seconds * 1e3
+              << " ms)" << std::endl;
+    std::cout << "[Renders] Field-subscribed views: " << fine.renders << " (" << fine.seconds * 1e3 << " ms)" << std::endl;
+    std::cout << "[Renders] Redundant renders removed: " << legacy - fine.renders << " ("
+              << 100.0 * (legacy - fine.renders) / std::max<uint64_t>(1, legacy) << "%)" << std::endl;
+
+    return 0;
+}
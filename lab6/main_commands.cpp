@@ -0,0 +1,192 @@
+#include "CommandQueue.h"
+#include <cstdlib>
+#include <random>
+
+template <typename Func>
+double Seconds(Func func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Пачка событий шлюза: в основном вызовы на небольшое число «горячих» этажей
+ControllerCommand NextCommand(std::mt19937& rng, int& floor) {
+    uint32_t roll = rng() % 100;
+    floor = 1 + static_cast<int>(rng() % 30);
+    if (roll < 80) return ControllerCommand::Call;
+    if (roll < 88) return ControllerCommand::Arrival;
+    if (roll < 94) return ControllerCommand::Load;
+    return ControllerCommand::Unload;
+}
+
+void SubmitTo(QueuedElevatorController& controller, ControllerCommand command, int floor, uint64_t& rejected) {
+    bool ok = true;
+    switch (command) {
+    case ControllerCommand::Call: ok = controller.HandleCallButton(floor); break;
+    case ControllerCommand::Arrival: ok = controller.SimulateArrival(); break;
+    case ControllerCommand::Load: ok = controller.HandleLoadEvent(); break;
+    default: ok = controller.HandleUnloadEvent(); break;
+    }
+    rejected += !ok;
+}
+
+// Принятое событие ставится повторно, пока в очереди не появится место
+void SubmitUntilAccepted(QueuedElevatorController& controller, ControllerCommand command, int floor) {
+    uint64_t rejected = 0;
+    do {
+        rejected = 0;
+        SubmitTo(controller, command, floor, rejected);
+        if (rejected) std::this_thread::yield();
+    } while (rejected);
+}
+
+void ApplyDirect(ElevatorController& controller, ControllerCommand command, int floor) {
+    switch (command) {
+    case ControllerCommand::Call: controller.HandleCallButton(floor); break;
+    case ControllerCommand::Arrival: controller.SimulateArrival(); break;
+    case ControllerCommand::Load: controller.HandleLoadEvent(); break;
+    default: controller.HandleUnloadEvent(); break;
+    }
+}
+
+void PrintStats(const char* label, const ControllerStats& m) {
+    std::cout << "[" << label << "] Accepted: " << m.accepted << ", duplicates dropped: " << m.duplicates
+              << ", rejected (queue full): " << m.rejected << ", applied: " << m.applied << " in " << m.batches
+              << " batches (avg " << m.AvgBatch() << "), max depth: " << m.maxDepth << std::endl;
+}
+
+// Параметры: [число потоков шлюза] [событий на поток] [емкость очереди]
+int main(int argc, char* argv[]) {
+    std::cout << "--- LR6: Queued Batching Controller ---" << std::endl;
+
+    int producers = argc > 1 ? std::atoi(argv[1]) : 2;
+    size_t perProducer = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 500000;
+    size_t capacity = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 4096;
+
+    // 1. Пачка событий: повторные вызовы на этаж 7 сливаются в один
+    {
+        ElevatorModel elevator{GetStandingState()};
+        ConsoleView1 view(&elevator);
+        QueuedElevatorController controller(&elevator);
+        for (int i = 0; i < 5; ++i) controller.HandleCallButton(7);
+        controller.SimulateArrival();
+        controller.HandleLoadEvent();
+        controller.Drain();
+        std::cout << std::endl;
+        PrintStats("Burst", controller.GetStats());
+    }
+
+    // Слияние не меняет итог: очередь и прямой контроллер приходят в одно состояние.
+    // Вызовы 5, 7, 5 — последний вызов задает цель, и он не сливается с первым
+    std::cout.setstate(std::ios::badbit);
+    auto sameFinalState = [](const std::vector<std::pair<ControllerCommand, int>>& trace) {
+        ElevatorModel direct{GetStandingState()};
+        ElevatorModel queued{GetStandingState()};
+        {
+            ElevatorController controller(&direct);
+            for (const auto& [command, floor] : trace) ApplyDirect(controller, command, floor);
+        }
+        {
+            QueuedElevatorController controller(&queued, 256);
+            for (const auto& [command, floor] : trace) SubmitUntilAccepted(controller, command, floor);
+            controller.Drain();
+        }
+        return direct.GetFloor() == queued.GetFloor() &&
+               direct.GetCurrentStateName() == queued.GetCurrentStateName();
+    };
+    bool sameRetarget = sameFinalState(
+        {{ControllerCommand::Call, 5}, {ControllerCommand::Call, 7}, {ControllerCommand::Call, 5}});
+    std::mt19937 traceRng(77);
+    std::vector<std::pair<ControllerCommand, int>> trace(100000);
+    for (auto& [command, floor] : trace) command = NextCommand(traceRng, floor);
+    bool sameRandom = sameFinalState(trace);
+    std::cout.clear();
+    std::cout << "[Check] Queued vs direct final state: calls 5, 7, 5: " << (sameRetarget ? "same" : "different")
+              << ", random trace of " << trace.size() << " events: " << (sameRandom ? "same" : "different") << std::endl;
+
+    // 2. Прежний контроллер: каждый вызов синхронно, со строкой журнала
+    std::cout.setstate(std::ios::badbit);
+    size_t total = perProducer * static_cast<size_t>(producers);
+    double direct;
+    {
+        ElevatorModel elevator{GetStandingState()};
+        ElevatorController controller(&elevator);
+        std::mt19937 rng(1);
+        direct = Seconds([&] {
+            for (size_t i = 0; i < total; ++i) {
+                int floor;
+                ControllerCommand command = NextCommand(rng, floor);
+                ApplyDirect(controller, command, floor);
+            }
+        });
+    }
+
+    // 3. Прием с максимальной скоростью из нескольких потоков шлюза
+    double ingest, endToEnd;
+    uint64_t saturatedRejects = 0;
+    ControllerStats saturated;
+    {
+        ElevatorModel elevator{GetStandingState()};
+        QueuedElevatorController controller(&elevator, capacity);
+        std::vector<std::thread> threads;
+        std::vector<uint64_t> rejects(producers, 0);
+        endToEnd = Seconds([&] {
+            ingest = Seconds([&] {
+                for (int p = 0; p < producers; ++p) {
+                    threads.emplace_back([&, p] {
+                        std::mt19937 rng(100 + p);
+                        for (size_t i = 0; i < perProducer; ++i) {
+                            int floor;
+                            ControllerCommand command = NextCommand(rng, floor);
+                            SubmitTo(controller, command, floor, rejects[p]);
+                        }
+                    });
+                }
+                for (auto& t : threads) t.join();
+            });
+            controller.Drain();
+        });
+        for (uint64_t r : rejects) saturatedRejects += r;
+        saturated = controller.GetStats();
+    }
+
+    // 4. Задержка при умеренной нагрузке: шлюз отправляет пачки по 32 события
+    ControllerStats paced;
+    {
+        ElevatorModel elevator{GetStandingState()};
+        QueuedElevatorController controller(&elevator, capacity);
+        std::mt19937 rng(9);
+        uint64_t rejected = 0;
+        for (int burst = 0; burst < 2000; ++burst) {
+            for (int i = 0; i < 32; ++i) {
+                int floor;
+                ControllerCommand command = NextCommand(rng, floor);
+                SubmitTo(controller, command, floor, rejected);
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        controller.Drain();
+        paced = controller.GetStats();
+    }
+    std::cout.clear();
+
+    std::cout << "\n--- Benchmark (" << producers << " gateway threads x " << perProducer << " events, queue "
+              << capacity << ") ---" << std::endl;
+    // Прямой контроллер применяет каждое событие; у очереди применяются только
+    // принятые, поэтому сравнивается скорость применения, а прием — отдельно
+    std::cout << "[Bench] Direct controller (log line per event): applied " << total / direct / 1e6 << " M events/s"
+              << std::endl;
+    std::cout << "[Bench] Queued: applied " << saturated.applied / endToEnd / 1e6
+              << " M events/s end-to-end incl. drain; gateway offered " << total / ingest / 1e6 << " M events/s, of them "
+              << 100.0 * saturated.duplicates / total << "% collapsed, " << 100.0 * saturated.rejected / total
+              << "% rejected (queue full)" << std::endl;
+    PrintStats("Saturated", saturated);
+    std::cout << "[Saturated] Producer-side rejects: " << saturatedRejects << ", latency p50 <= "
+              << saturated.LatencyQuantileNs(0.5) / 1000.0 << " us, p99 <= " << saturated.LatencyQuantileNs(0.99) / 1000.0
+              << " us" << std::endl;
+    PrintStats("Paced", paced);
+    std::cout << "[Paced] Latency p50 <= " << paced.LatencyQuantileNs(0.5) / 1000.0 << " us, p99 <= "
+              << paced.LatencyQuantileNs(0.99) / 1000.0 << " us" << std::endl;
+
+    return 0;
+}
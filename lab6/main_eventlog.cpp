@@ -0,0 +1,216 @@
+#include "EventLog.h"
+#include <cstdlib>
+#include <random>
+
+template <typename Func>
+double Seconds(Func func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+std::string StateName(uint8_t id) {
+    IElevatorState* state = StateFromId(id);
+    return state ? state->GetName() : "Unknown";
+}
+
+void PrintRecord(const LogRecord& r, uint64_t origin) {
+    std::cout << "  #" << r.sequence << " +" << (r.timestampNs - origin) / 1000 << " us ";
+    switch (r.kind) {
+    case kRecordCommand:
+        std::cout << "Command " << CommandName(static_cast<ControllerCommand>(r.command));
+        if (static_cast<ControllerCommand>(r.command) == ControllerCommand::Call) std::cout << " " << r.floor;
+        break;
+    case kRecordTransition:
+        std::cout << "Transition " << StateName(r.stateBefore) << " -> " << StateName(r.state) << ", floor " << r.floor
+                  << (r.overloaded ? ", overloaded" : "");
+        break;
+    default:
+        std::cout << "Snapshot " << StateName(r.state) << ", floor " << r.floor << (r.overloaded ? ", overloaded" : "");
+        break;
+    }
+    std::cout << std::endl;
+}
+
+bool Matches(const LoggedModelState& logged, const ElevatorSnapshot& live) {
+    return StateFromId(logged.state) == live.state && logged.floor == live.floor && logged.overloaded == live.overloaded;
+}
+
+// Параметры: [путь к журналу] [число команд в замере] [интервал снимков]
+int main(int argc, char* argv[]) {
+    std::cout << "--- LR6: Event-Sourced Elevator Log ---" << std::endl;
+
+    std::string path = argc > 1 ? argv[1] : "elevator_events.log";
+    size_t commands = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2000000;
+    uint32_t interval = argc > 3 ? static_cast<uint32_t>(std::strtoul(argv[3], nullptr, 10)) : 1024;
+
+    // 1. Инцидент: сценарий MVC с аварийной остановкой, затем разбор по журналу
+    std::remove(path.c_str());
+    {
+        std::cout.setstate(std::ios::badbit);
+        ElevatorModel elevator{GetStandingState()};
+        ElevatorController controller(&elevator);
+        EventLog log(path, &elevator, interval);
+        controller.HandleCallButton(5);
+        controller.SimulateArrival();
+        controller.HandleLoadEvent();
+        controller.HandleCallButton(10);
+        controller.HandleUnloadEvent();
+        controller.HandlePowerLoss();
+        controller.HandlePowerRestore();
+        controller.HandleCallButton(8);
+        controller.HandleEmergency();
+        std::cout.clear();
+    }
+    {
+        EventLogReader reader(path);
+        uint64_t origin = reader[0].timestampNs;
+        std::cout << "\n[Log] " << reader.Size() << " records:" << std::endl;
+        size_t emergency = reader.Size();
+        for (const LogRecord& r : reader) {
+            PrintRecord(r, origin);
+            if (r.kind == kRecordCommand && static_cast<ControllerCommand>(r.command) == ControllerCommand::Emergency) {
+                emergency = &r - reader.begin();
+            }
+        }
+        LoggedModelState before = reader.StateAt(reader[emergency].timestampNs - 1);
+        LoggedModelState after = reader.StateAfter(reader.Size());
+        std::cout << "\n[Incident] Before Emergency: " << StateName(before.state) << " at floor " << before.floor
+                  << "; after: " << StateName(after.state) << " at floor " << after.floor << std::endl;
+
+        std::cout.setstate(std::ios::badbit);
+        ElevatorModel replayed{GetStandingState()};
+        size_t applied = reader.ReplayInto(replayed, emergency);
+        std::cout.clear();
+        std::cout << "[Incident] Replayed " << applied << " commands up to the Emergency: "
+                  << replayed.GetCurrentStateName() << " at floor " << replayed.GetFloor()
+                  << (Matches(before, replayed.GetSnapshot()) ? " (matches log)" : " (MISMATCH)") << std::endl;
+    }
+
+    // Повторное открытие после перезапуска с отставшими часами: последняя запись
+    // сдвигается на час вперед, новые записи не должны оказаться раньше нее
+    {
+        int fd = ::open(path.c_str(), O_RDWR);
+        struct stat info;
+        ::fstat(fd, &info);
+        off_t lastOffset = info.st_size - static_cast<off_t>(sizeof(LogRecord));
+        LogRecord last{};
+        ::pread(fd, &last, sizeof(last), lastOffset);
+        last.timestampNs += 3600ull * 1000000000ull;
+        ::pwrite(fd, &last, sizeof(last), lastOffset);
+        ::close(fd);
+
+        std::cout.setstate(std::ios::badbit);
+        ElevatorModel elevator{GetStandingState()};
+        ElevatorController controller(&elevator);
+        {
+            EventLog log(path, &elevator, interval);
+            controller.HandleCallButton(2);
+        }
+        std::cout.clear();
+        EventLogReader reader(path);
+        bool ordered = std::is_sorted(reader.begin(), reader.end(),
+                                      [](const LogRecord& a, const LogRecord& b) { return a.timestampNs < b.timestampNs; });
+        std::cout << "[Reopen] " << reader.Size() << " records after appending to the log, timestamps ordered: "
+                  << (ordered ? "yes" : "no") << std::endl;
+    }
+
+    // Снимок с поврежденным кодом состояния не применяется к модели
+    {
+        int fd = ::open(path.c_str(), O_RDWR);
+        LogRecord snapshot{};
+        ::pread(fd, &snapshot, sizeof(snapshot), sizeof(LogHeader));
+        snapshot.state = 0xEE;
+        ::pwrite(fd, &snapshot, sizeof(snapshot), sizeof(LogHeader));
+        ::close(fd);
+        EventLogReader reader(path);
+        std::cout.setstate(std::ios::badbit);
+        ElevatorModel replayed{GetStandingState()};
+        std::string error;
+        try {
+            reader.ReplayInto(replayed, 1);
+        } catch (const std::runtime_error& e) {
+            error = e.what();
+        }
+        std::cout.clear();
+        std::cout << "[Corrupt] Replay from a snapshot with an unknown state: "
+                  << (error.empty() ? "accepted" : "rejected (" + error + ")") << std::endl;
+    }
+
+    // 2. Замер: поток команд с журналом и без
+    std::cout.setstate(std::ios::badbit);
+    auto drive = [commands](ElevatorModel& model) {
+        std::mt19937 rng(3);
+        for (size_t i = 0; i < commands; ++i) {
+            uint32_t roll = rng() % 100;
+            if (roll < 50) model.Call(1 + static_cast<int>(rng() % 30));
+            else if (roll < 80) model.Unload();
+            else if (roll < 90) model.Load();
+            else if (roll < 95) model.PowerLoss();
+            else if (roll < 99) model.RestorePower();
+            else model.Emergency();
+            // Выход из аварии — через обслуживание, моделируется отключением питания
+            if (model.GetSnapshot().state == GetMalfunctionState()) model.PowerLoss();
+        }
+    };
+    double plain, logged;
+    ElevatorSnapshot live;
+    {
+        ElevatorModel model{GetStandingState()};
+        plain = Seconds([&] { drive(model); });
+    }
+    std::remove(path.c_str());
+    {
+        ElevatorModel model{GetStandingState()};
+        EventLog log(path, &model, interval);
+        logged = Seconds([&] { drive(model); log.Flush(); });
+        live = model.GetSnapshot();
+    }
+
+    // 3. Воспроизведение через mmap
+    EventLogReader reader(path);
+    size_t records = reader.Size(), commandRecords = 0;
+    uint64_t perState[6] = {};
+    double fold = Seconds([&] {
+        for (const LogRecord& r : reader) {
+            commandRecords += r.kind == kRecordCommand;
+            if (r.kind == kRecordTransition) ++perState[r.state];
+        }
+    });
+    LoggedModelState last = reader.StateAfter(records);
+
+    std::mt19937_64 rng(17);
+    uint64_t first = reader[0].timestampNs, span = reader[records - 1].timestampNs - first + 1;
+    size_t queries = 200000;
+    uint64_t checksum = 0;
+    double pointQueries = Seconds([&] {
+        for (size_t i = 0; i < queries; ++i) checksum += reader.StateAt(first + rng() % span).floor;
+    });
+
+    ElevatorModel replayed{GetStandingState()};
+    size_t applied = 0;
+    // Полный прогон от начального состояния (совпадает с первым снимком)
+    double reexecute = Seconds([&] { applied = reader.ApplyCommands(replayed, 0, records); });
+    ElevatorModel fromSnapshot{GetStandingState()};
+    size_t tail = reader.ReplayInto(fromSnapshot, records);
+    std::cout.clear();
+
+    std::cout << "\n--- Benchmark (" << commands << " commands, snapshot every " << interval << " records) ---" << std::endl;
+    std::cout << "[Write] Without log: " << commands / plain / 1e6 << " M commands/s, with log: "
+              << commands / logged / 1e6 << " M commands/s" << std::endl;
+    std::cout << "[Size] " << reader.GetFileSize() << " bytes, " << records << " records (" << commandRecords
+              << " commands): " << sizeof(LogRecord) << " bytes/record, "
+              << static_cast<double>(reader.GetFileSize()) / commandRecords << " bytes/command" << std::endl;
+    std::cout << "[Replay] Sequential scan: " << records / fold / 1e6 << " M events/s (transitions into Malfunction: "
+              << perState[kStateMalfunction] << ")" << std::endl;
+    std::cout << "[Replay] Point-in-time state: " << queries / pointQueries / 1e6 << " M queries/s (checksum "
+              << checksum << ")" << std::endl;
+    std::cout << "[Replay] Re-execution through ElevatorModel: " << applied / reexecute / 1e6 << " M events/s" << std::endl;
+    std::cout << "[Check] Folded final state matches live model: " << (Matches(last, live) ? "yes" : "no")
+              << "; re-executed: " << (replayed.GetSnapshot().state == live.state && replayed.GetFloor() == live.floor ? "yes" : "no")
+              << "; from last snapshot (" << tail << " commands): "
+              << (fromSnapshot.GetSnapshot().state == live.state && fromSnapshot.GetFloor() == live.floor ? "yes" : "no")
+              << std::endl;
+
+    return 0;
+}
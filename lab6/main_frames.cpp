@@ -0,0 +1,107 @@
+#include "ElevatorMVC.h"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <thread>
+
+// Кадры в секунду за отведенное время
+template <typename RenderFunc>
+double MeasureFps(std::chrono::milliseconds duration, RenderFunc render) {
+    auto start = std::chrono::steady_clock::now();
+    auto until = start + duration;
+    uint64_t frames = 0;
+    while (std::chrono::steady_clock::now() < until) {
+        render();
+        ++frames;
+    }
+    return frames / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Параметры: [число лифтов] [длительность замера, мс]
+int main(int argc, char* argv[]) {
+    std::cout << "--- LR6: Double-Buffered Render Frames ---" << std::endl;
+
+    size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000;
+    std::chrono::milliseconds duration(argc > 2 ? std::atoi(argv[2]) : 1000);
+
+    // Модели, их консольные представления и слой кадров
+    std::cout.setstate(std::ios::badbit);
+    std::vector<std::unique_ptr<ElevatorModel>> models;
+    std::vector<std::unique_ptr<ConsoleView1>> statusViews;
+    std::vector<std::unique_ptr<ConsoleView2>> detailViews;
+    StatusFrameView statusFrame;
+    DetailedFrameView detailFrame;
+    FrameRenderer renderer;
+    renderer.AddView(&statusFrame);
+    renderer.AddView(&detailFrame);
+    std::mt19937 rng(7);
+    for (size_t i = 0; i < count; ++i) {
+        models.push_back(std::make_unique<ElevatorModel>(GetStandingState()));
+        ElevatorController controller(models.back().get());
+        controller.HandleCallButton(2 + static_cast<int>(rng() % 30));
+        if (rng() % 3 == 0) controller.SimulateArrival();
+        statusViews.push_back(std::make_unique<ConsoleView1>(models.back().get()));
+        detailViews.push_back(std::make_unique<ConsoleView2>(models.back().get()));
+        renderer.AddModel(models.back().get());
+    }
+    std::cout.clear();
+
+    // Прежний путь: print() каждого представления, множество << и endl на строку
+    auto legacyFrame = [&] {
+        for (size_t i = 0; i < count; ++i) {
+            statusViews[i]->print();
+            detailViews[i]->print();
+        }
+    };
+
+    // 1. Кадр совпадает побайтно с выводом print()
+    std::ostringstream legacyText, frameText;
+    std::streambuf* console = std::cout.rdbuf(legacyText.rdbuf());
+    legacyFrame();
+    std::cout.rdbuf(console);
+    renderer.RenderFrame(frameText);
+    std::cout << "\n[Check] Frame output matches print() of both views: "
+              << (legacyText.str() == frameText.str() ? "yes" : "no") << " (" << frameText.str().size()
+              << " bytes per frame)" << std::endl;
+
+    // 2. FPS: вывод в /dev/null, чтобы мерить форматирование и системные вызовы, а не терминал
+    std::ofstream sink("/dev/null");
+    console = std::cout.rdbuf(sink.rdbuf());
+    double legacyFps = MeasureFps(duration, legacyFrame);
+    std::cout.rdbuf(console);
+    double frameFps = MeasureFps(duration, [&] { renderer.RenderFrame(sink); });
+    renderer.SetSkipUnchanged(true);
+    double idleFps = MeasureFps(duration, [&] { renderer.RenderFrame(sink); });
+    renderer.SetSkipUnchanged(false);
+
+    // 3. FPS при одновременных изменениях моделей из потока контроллера
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> updates{0};
+    std::cout.setstate(std::ios::badbit); // Синхронные оповещения моделей не печатаются
+    std::thread controllerThread([&] {
+        std::mt19937 local(11);
+        while (!stop.load(std::memory_order_relaxed)) {
+            ElevatorModel& model = *models[local() % count];
+            model.SetFloor(1 + static_cast<int>(local() % 30));
+            model.SetOverloaded(local() % 2 == 0);
+            updates.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    double concurrentFps = MeasureFps(duration, [&] { renderer.RenderFrame(sink); });
+    stop.store(true);
+    controllerThread.join();
+    std::cout.clear();
+
+    std::cout << "\n--- Render benchmark (" << count << " elevators, 2 views each) ---" << std::endl;
+    std::cout << "[FPS] Console views (<< + endl per line): " << legacyFps << std::endl;
+    std::cout << "[FPS] Snapshot frames (one write per frame): " << frameFps << " (" << frameFps / legacyFps
+              << "x)" << std::endl;
+    std::cout << "[FPS] Snapshot frames, unchanged frames skipped (idle models): " << idleFps << " ("
+              << renderer.GetSkippedFrames() << " writes avoided)" << std::endl;
+    std::cout << "[FPS] Snapshot frames with concurrent model updates: " << concurrentFps << " ("
+              << updates.load() << " model updates)" << std::endl;
+
+    return 0;
+}
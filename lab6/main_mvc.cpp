@@ -47,7 +47,7 @@ int main() {
 
     // 1. Создание МОДЕЛИ (Model), инициализация в Standing
     // Используем {} для чистой инициализации
-    ElevatorModel elevator{std::unique_ptr<IElevatorState>(GetStandingState())};
+    ElevatorModel elevator{GetStandingState()};
     
     // 2. Создание ПРЕДСТАВЛЕНИЙ (View), подписка на Модель происходит в конструкторе
     ConsoleView1 view1(&elevator);
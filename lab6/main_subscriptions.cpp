@@ -0,0 +1,231 @@
+#include "ElevatorMVC.h"
+#include <chrono>
+#include <cstdlib>
+#include <random>
+
+// Наблюдатель для стресс-теста: вызов после завершенной отписки — нарушение
+class ProbeObserver : public Observer {
+public:
+    static inline std::atomic<uint64_t> violations{0};
+    std::atomic<bool> retired{false};
+    std::atomic<uint64_t> calls{0};
+
+    void update() override {
+        if (retired.load(std::memory_order_acquire)) violations.fetch_add(1, std::memory_order_relaxed);
+        calls.fetch_add(1, std::memory_order_relaxed);
+    }
+};
+
+// Отписывается при первом оповещении, изнутри обхода, и удаляет себя через
+// отложенное освобождение. Вызов после начала освобождения — нарушение; вызов
+// после самого delete обнаружил бы AddressSanitizer
+class OneShotObserver : public Observer {
+private:
+    Observable* subject_;
+    std::atomic<bool> fired_{false};
+    std::atomic<bool> detachReturned_{false};
+    std::atomic<bool> disposed_{false};
+
+public:
+    std::atomic<SubscriptionHandle> handle{SubscriptionHandle{}}; // Записывается после AddObserver
+    static inline std::atomic<uint64_t> detached{0}, destroyed{0}, inFlightAfterDetach{0}, violations{0};
+
+    explicit OneShotObserver(Observable* subject) : subject_(subject) {}
+    ~OneShotObserver() override { destroyed.fetch_add(1); }
+
+    // Освобождение: после него реестр не должен вызывать наблюдателя
+    void Dispose() {
+        disposed_.store(true, std::memory_order_release);
+        delete this;
+    }
+
+    void update() override {
+        if (disposed_.load(std::memory_order_acquire)) violations.fetch_add(1, std::memory_order_relaxed);
+        // Другой поток-оповещатель успел взять наблюдателя до отписки: допустимо до освобождения
+        if (detachReturned_.load(std::memory_order_acquire)) inFlightAfterDetach.fetch_add(1, std::memory_order_relaxed);
+        SubscriptionHandle own = handle.load();
+        if (own.IsValid() && !fired_.exchange(true) && subject_->RetireObserver(own, [this] { Dispose(); })) {
+            detachReturned_.store(true, std::memory_order_release);
+            detached.fetch_add(1);
+        }
+    }
+};
+
+struct StressReport {
+    uint64_t notifications = 0, subscribed = 0, unsubscribed = 0, staleRejected = 0, staleAccepted = 0;
+    size_t live = 0, registered = 0, oneShots = 0;
+};
+
+// Потоки оповещения, потоки подписки/отписки и самоотписывающиеся наблюдатели одновременно
+StressReport RunStress(std::chrono::milliseconds duration) {
+    Observable subject;
+    std::atomic<bool> stop{false};
+    std::atomic<uint64_t> notifications{0}, subscribed{0}, unsubscribed{0}, staleRejected{0}, staleAccepted{0};
+    std::vector<std::unique_ptr<ProbeObserver>> graveyard[2]; // Не удаляются до конца: вызов после отписки обнаружим
+    std::vector<std::pair<std::unique_ptr<ProbeObserver>, SubscriptionHandle>> alive[2];
+    // Сработавшие наблюдатели удаляют себя сами; указатель здесь разыменовывается
+    // только через dispose, который для устаревшего дескриптора не вызывается
+    std::vector<std::pair<OneShotObserver*, SubscriptionHandle>> oneShots;
+
+    std::vector<std::thread> threads;
+    for (int n = 0; n < 2; ++n) {
+        threads.emplace_back([&] {
+            while (!stop.load()) {
+                subject.NotifyUpdate();
+                notifications.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+    for (int c = 0; c < 2; ++c) {
+        threads.emplace_back([&, c] {
+            std::mt19937 rng(c + 1);
+            while (!stop.load()) {
+                if (alive[c].size() < 64 && (alive[c].empty() || rng() % 2)) {
+                    auto probe = std::make_unique<ProbeObserver>();
+                    SubscriptionHandle handle = subject.AddObserver(probe.get());
+                    alive[c].emplace_back(std::move(probe), handle);
+                    subscribed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    size_t victim = rng() % alive[c].size();
+                    std::swap(alive[c][victim], alive[c].back());
+                    auto [probe, handle] = std::move(alive[c].back());
+                    alive[c].pop_back();
+                    subject.RemoveObserver(handle);
+                    probe->retired.store(true, std::memory_order_release);
+                    unsubscribed.fetch_add(1, std::memory_order_relaxed);
+                    // Повторная отписка тем же дескриптором должна отклоняться
+                    (subject.RemoveObserver(handle) ? staleAccepted : staleRejected).fetch_add(1);
+                    graveyard[c].push_back(std::move(probe));
+                }
+            }
+        });
+    }
+    threads.emplace_back([&] {
+        while (!stop.load()) {
+            auto* observer = new OneShotObserver(&subject);
+            SubscriptionHandle handle = subject.AddObserver(observer);
+            observer->handle.store(handle);
+            oneShots.emplace_back(observer, handle);
+            std::this_thread::yield();
+        }
+    });
+
+    std::this_thread::sleep_for(duration);
+    stop.store(true);
+    for (auto& t : threads) t.join();
+
+    StressReport report;
+    report.notifications = notifications;
+    report.subscribed = subscribed;
+    report.unsubscribed = unsubscribed;
+    report.staleRejected = staleRejected;
+    report.staleAccepted = staleAccepted;
+    report.live = alive[0].size() + alive[1].size() + oneShots.size() - OneShotObserver::detached.load();
+    report.registered = subject.GetObserverCount();
+    for (auto& list : alive) {
+        for (auto& entry : list) subject.RemoveObserver(entry.second);
+    }
+    for (auto& [observer, handle] : oneShots) subject.RetireObserver(handle, [observer = observer] { observer->Dispose(); });
+    subject.SynchronizeObservers();
+    report.oneShots = oneShots.size();
+    return report;
+}
+
+template <typename Func>
+double Seconds(Func func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Параметры: [число наблюдателей в замере] [длительность стресс-теста, мс]
+int main(int argc, char* argv[]) {
+    std::cout << "--- LR6: Observer Subscription Management ---" << std::endl;
+
+    // 1. Представление отписывается при разрушении, в том числе посреди сценария
+    {
+        ElevatorModel elevator{GetStandingState()};
+        ConsoleView1 view1(&elevator);
+        ElevatorController controller(&elevator);
+        {
+            ConsoleView2 dashboard(&elevator);
+            controller.HandleCallButton(3);
+            std::cout << "\n[Subscriptions] Dashboard detached." << std::endl;
+        }
+        controller.SimulateArrival();
+        std::cout << "\n[Subscriptions] Observers attached: " << elevator.GetObserverCount() << std::endl;
+    }
+
+    size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20000;
+    std::chrono::milliseconds duration(argc > 2 ? std::atoi(argv[2]) : 1000);
+
+    // 2. Стресс-тест: оповещения, подписка/отписка и самоотписка в разных потоках
+    std::cout.setstate(std::ios::badbit);
+    StressReport stress = RunStress(duration);
+    std::cout.clear();
+    std::cout << "\n--- Stress test (" << duration.count() << " ms, 2 notifiers, 2 churn threads, one-shot observers) ---" << std::endl;
+    std::cout << "[Stress] Notifications: " << stress.notifications << ", subscribed: " << stress.subscribed
+              << ", unsubscribed: " << stress.unsubscribed << ", self-detached: " << OneShotObserver::detached.load() << std::endl;
+    std::cout << "[Stress] Calls after unsubscribe: " << ProbeObserver::violations.load()
+              << ", stale handles rejected: " << stress.staleRejected << "/" << stress.staleRejected + stress.staleAccepted << std::endl;
+    std::cout << "[Stress] Registry size matches live observers: " << (stress.live == stress.registered ? "yes" : "no")
+              << " (" << stress.registered << ")" << std::endl;
+    std::cout << "[Stress] One-shot observers: " << stress.oneShots << " created, " << OneShotObserver::destroyed.load()
+              << " destroyed, calls after disposal: " << OneShotObserver::violations.load()
+              << ", in-flight calls after self-detach (before disposal): " << OneShotObserver::inFlightAfterDetach.load()
+              << std::endl;
+
+    // Обход отслеживается для каждого реестра отдельно: внутри обхода first реестр
+    // second не считает себя обходимым, и отписка из него ждет его читателей
+    {
+        ProbeObserver a, b;
+        ObserverRegistry<Observer> first, second;
+        first.Add(&a);
+        SubscriptionHandle inSecond = second.Add(&b);
+        bool firstInside = false, secondInside = true;
+        first.ForEach([&](Observer*) {
+            firstInside = first.InIteration();
+            secondInside = second.InIteration();
+            second.Remove(inSecond);
+        });
+        std::cout << "[Registry] Inside a pass over one registry: iterating it: " << (firstInside ? "yes" : "no")
+                  << ", another registry of the same type: " << (secondInside ? "yes" : "no") << std::endl;
+    }
+
+    // 3. Замер: подписка/отписка в случайном порядке и обход
+    std::vector<ProbeObserver> probes(count);
+    std::vector<size_t> order(count);
+    for (size_t i = 0; i < count; ++i) order[i] = i;
+    std::shuffle(order.begin(), order.end(), std::mt19937(5));
+
+    ObserverRegistry<Observer> registry;
+    std::vector<SubscriptionHandle> handles(count);
+    double registryAdd = Seconds([&] { for (size_t i = 0; i < count; ++i) handles[i] = registry.Add(&probes[i]); });
+    uint64_t visited = 0;
+    double registryIterate = Seconds([&] {
+        for (int pass = 0; pass < 100; ++pass) registry.ForEach([&](Observer* o) { visited += o != nullptr; });
+    });
+    double registryRemove = Seconds([&] { for (size_t i : order) registry.Remove(handles[i]); });
+
+    std::vector<Observer*> vector;
+    double vectorAdd = Seconds([&] { for (size_t i = 0; i < count; ++i) vector.push_back(&probes[i]); });
+    double vectorIterate = Seconds([&] {
+        for (int pass = 0; pass < 100; ++pass) {
+            for (Observer* o : vector) visited += o != nullptr;
+        }
+    });
+    double vectorRemove = Seconds([&] {
+        for (size_t i : order) vector.erase(std::find(vector.begin(), vector.end(), &probes[i]));
+    });
+
+    std::cout << "\n--- Benchmark (" << count << " observers) ---" << std::endl;
+    std::cout << "[Bench] Registry: subscribe " << registryAdd / count * 1e9 << " ns, unsubscribe "
+              << registryRemove / count * 1e9 << " ns, notify pass " << registryIterate / 100 / count * 1e9
+              << " ns/observer" << std::endl;
+    std::cout << "[Bench] Vector + find/erase: subscribe " << vectorAdd / count * 1e9 << " ns, unsubscribe "
+              << vectorRemove / count * 1e9 << " ns, notify pass " << vectorIterate / 100 / count * 1e9
+              << " ns/observer" << std::endl;
+    std::cout << "[Bench] Visited: " << visited << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "Directory.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+
+// --- Общие средства демонстраций LR7 ---
+// Таймер, генератор имен и телефонов для тестовых справочников и
+// (по запросу) счетчик выделений памяти.
+
+template <typename Func>
+double Seconds(Func func) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Первые 16 фамилий — короткий набор с длинными группами однофамильцев
+inline const char* const kSurnames[] = {
+    "Ivanov", "Petrov", "Sidorov", "Smirnov", "Kuznetsov", "Popov", "Vasiliev", "Sokolov", "Mikhailov", "Novikov",
+    "Fedorov", "Morozov", "Volkov", "Alekseev", "Lebedev", "Zuev", "Egorov", "Pavlov", "Kozlov", "Stepanov",
+    "Nikolaev", "Orlov", "Andreev", "Makarov", "Nikitin", "Zakharov", "Zaitsev", "Soloviev", "Borisov", "Yakovlev",
+    "Grigoriev", "Romanov", "Vorobiev", "Sergeev", "Kuzmin", "Frolov", "Alexandrov", "Dmitriev", "Korolev", "Gusev",
+    "Kiselev", "Ilyin", "Maksimov", "Polyakov", "Sorokin", "Vinogradov", "Kovalev", "Belov", "Medvedev", "Antonov",
+    "Tarasov", "Zhukov", "Baranov", "Filippov", "Komarov", "Davydov", "Belyaev", "Gerasimov", "Bogdanov", "Osipov",
+    "Sidorenko", "Matveev", "Titov", "Semenov"};
+
+// «Фамилия И.О.» из первых surnames фамилий (16 или 64)
+inline std::string RandomName(std::mt19937_64& rng, size_t surnames = 16) {
+    std::string name = kSurnames[rng() % surnames];
+    name += ' ';
+    name += char('A' + rng() % 26);
+    name += '.';
+    name += char('A' + rng() % 26);
+    name += '.';
+    return name;
+}
+
+// Телефон в справочнике: 8-9XX-XXX-XXXX
+inline std::string RandomPhone(std::mt19937_64& rng) {
+    char phone[32];
+    uint64_t digits = rng();
+    std::snprintf(phone, sizeof(phone), "8-9%02u-%03u-%04u", unsigned(digits % 100), unsigned(digits / 100 % 1000),
+                  unsigned(digits / 100000 % 10000));
+    return phone;
+}
+
+// Физ. лицо в Москве со случайными именем и телефоном
+inline Contact* RandomContact(std::mt19937_64& rng, size_t surnames = 16) {
+    std::string name = RandomName(rng, surnames);
+    return new Contact(name, RandomPhone(rng), "Moscow");
+}
+
+// Счетчик выделений памяти. Заменяет глобальный operator new во всей программе,
+// поэтому включается явно: #define BENCH_COUNT_ALLOCATIONS перед подключением,
+// в одном файле программы
+#ifdef BENCH_COUNT_ALLOCATIONS
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+inline std::atomic<uint64_t> g_allocations{0};
+
+__attribute__((noinline)) void* operator new(size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+__attribute__((noinline)) void operator delete(void* p) noexcept { std::free(p); }
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept { std::free(p); }
+#endif
@@ -0,0 +1,115 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// --- Арена справочника и пул повторяющихся строк ---
+// Контакты и их строки размещаются подряд в крупных блоках, выделяемых
+// с геометрическим ростом; отдельные объекты не освобождаются — вся арена
+// освобождается разом вместе со справочником (десятки блоков вместо
+// миллионов delete). Деструкторы объектов арены не вызываются, поэтому в ней
+// размещаются только объекты, не владеющие другими ресурсами.
+
+class ContactArena {
+private:
+    static constexpr size_t kFirstBlock = 64 * 1024;
+    static constexpr size_t kMaxBlock = 64 * 1024 * 1024;
+
+    std::vector<std::unique_ptr<char[]>> blocks_;
+    char* cursor_ = nullptr;
+    size_t left_ = 0;
+    size_t nextBlock_ = kFirstBlock;
+    size_t used_ = 0;
+    size_t reserved_ = 0;
+
+public:
+    ContactArena() = default;
+    ContactArena(const ContactArena&) = delete;
+    ContactArena& operator=(const ContactArena&) = delete;
+
+    void* Allocate(size_t size, size_t alignment) {
+        size_t padding = (alignment - reinterpret_cast<uintptr_t>(cursor_) % alignment) % alignment;
+        if (!cursor_ || padding + size > left_) {
+            size_t blockSize = std::max(nextBlock_, size + alignment);
+            blocks_.emplace_back(new char[blockSize]);
+            cursor_ = blocks_.back().get();
+            left_ = blockSize;
+            reserved_ += blockSize;
+            nextBlock_ = std::min(nextBlock_ * 2, kMaxBlock);
+            padding = (alignment - reinterpret_cast<uintptr_t>(cursor_) % alignment) % alignment;
+        }
+        void* result = cursor_ + padding;
+        cursor_ += padding + size;
+        left_ -= padding + size;
+        used_ += size;
+        return result;
+    }
+
+    template <typename T, typename... Args>
+    T* Create(Args&&... args) {
+        return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    std::string_view CopyString(std::string_view text) {
+        if (text.empty()) return {};
+        char* data = static_cast<char*>(Allocate(text.size(), 1));
+        std::memcpy(data, text.data(), text.size());
+        return std::string_view(data, text.size());
+    }
+
+    size_t BytesUsed() const { return used_; }
+    size_t BytesReserved() const { return reserved_; }
+    size_t BlockCount() const { return blocks_.size(); }
+};
+
+// Пул строк: одинаковые адреса и формы собственности хранятся в арене один раз.
+// Открытая адресация с линейным пробированием, как в ContactHashIndex
+class StringInterner {
+private:
+    struct Slot {
+        uint64_t hash = 0;
+        std::string_view text; // data() == nullptr — свободный слот
+    };
+
+    ContactArena& arena_;
+    std::vector<Slot> slots_;
+    size_t mask_ = 0;
+    size_t size_ = 0;
+
+    void Grow() {
+        std::vector<Slot> old = std::move(slots_);
+        slots_.assign(old.empty() ? 16 : old.size() * 2, Slot{});
+        mask_ = slots_.size() - 1;
+        for (const Slot& slot : old) {
+            if (!slot.text.data()) continue;
+            size_t i = slot.hash & mask_;
+            while (slots_[i].text.data()) i = (i + 1) & mask_;
+            slots_[i] = slot;
+        }
+    }
+
+public:
+    explicit StringInterner(ContactArena& arena) : arena_(arena) {}
+
+    std::string_view Intern(std::string_view text) {
+        if (text.empty()) return {};
+        if ((size_ + 1) * 2 > slots_.size()) Grow();
+        uint64_t hash = std::hash<std::string_view>{}(text);
+        size_t i = hash & mask_;
+        for (; slots_[i].text.data(); i = (i + 1) & mask_) {
+            if (slots_[i].hash == hash && slots_[i].text == text) return slots_[i].text;
+        }
+        slots_[i] = {hash, arena_.CopyString(text)};
+        ++size_;
+        return slots_[i].text;
+    }
+
+    size_t Size() const { return size_; }
+    size_t MemoryBytes() const { return slots_.capacity() * sizeof(Slot); }
+};
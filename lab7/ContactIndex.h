@@ -0,0 +1,126 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// --- Хеш-индексы справочника ---
+// Открытая адресация с линейным пробированием: слот хранит полный хеш ключа
+// и указатель на контакт (16 байт), сам ключ читается из контакта через KeyOf.
+// Одинаковые ключи (однофамильцы) лежат в одной цепочке проб. Удаление —
+// обратным сдвигом, без «надгробий», поэтому цепочки не деградируют.
+
+// Нормализация телефона: только цифры; 11-значный номер с ведущей 8 приводится к 7
+// (8-901-... и +7 901 ... — один номер). Возвращает длину или 0, если не поместилось
+inline size_t NormalizePhone(std::string_view phone, char* out, size_t capacity) {
+    size_t length = 0;
+    for (char c : phone) {
+        if (c < '0' || c > '9') continue;
+        if (length == capacity) return 0;
+        out[length++] = c;
+    }
+    if (length == 11 && out[0] == '8') out[0] = '7';
+    return length;
+}
+
+inline std::string NormalizePhone(std::string_view phone) {
+    std::string digits;
+    for (char c : phone) {
+        if (c >= '0' && c <= '9') digits.push_back(c);
+    }
+    if (digits.size() == 11 && digits[0] == '8') digits[0] = '7';
+    return digits;
+}
+
+template <typename Record, typename KeyOf>
+class ContactHashIndex {
+private:
+    struct Slot {
+        uint64_t hash = 0;
+        Record* record = nullptr; // nullptr — свободный слот
+    };
+
+    std::vector<Slot> slots_;
+    size_t mask_ = 0;
+    size_t size_ = 0;
+
+    static uint64_t Hash(std::string_view key) { return std::hash<std::string_view>{}(key); }
+
+    void Grow() {
+        std::vector<Slot> old = std::move(slots_);
+        slots_.assign(old.empty() ? 16 : old.size() * 2, Slot{});
+        mask_ = slots_.size() - 1;
+        for (const Slot& slot : old) {
+            if (!slot.record) continue;
+            size_t i = slot.hash & mask_;
+            while (slots_[i].record) i = (i + 1) & mask_;
+            slots_[i] = slot;
+        }
+    }
+
+public:
+    void Reserve(size_t count) {
+        while (slots_.size() < count * 2) Grow();
+    }
+
+    void Add(Record* record) {
+        if ((size_ + 1) * 2 > slots_.size()) Grow(); // Заполнение не выше 1/2
+        uint64_t hash = Hash(KeyOf{}(*record));
+        size_t i = hash & mask_;
+        while (slots_[i].record) i = (i + 1) & mask_;
+        slots_[i] = {hash, record};
+        ++size_;
+    }
+
+    // Удаляется именно эта запись (по указателю), а не любая с тем же ключом
+    bool Remove(const Record* record) {
+        if (!size_) return false;
+        size_t i = Hash(KeyOf{}(*record)) & mask_;
+        while (slots_[i].record != record) {
+            if (!slots_[i].record) return false;
+            i = (i + 1) & mask_;
+        }
+        // Обратный сдвиг: слоты цепочки, чья «домашняя» позиция не между i и j, сдвигаются в дыру
+        for (size_t j = (i + 1) & mask_; slots_[j].record; j = (j + 1) & mask_) {
+            size_t home = slots_[j].hash & mask_;
+            bool between = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+            if (!between) {
+                slots_[i] = slots_[j];
+                i = j;
+            }
+        }
+        slots_[i] = Slot{};
+        --size_;
+        return true;
+    }
+
+    // Первая запись с ключом; без выделения памяти
+    Record* Find(std::string_view key) const {
+        if (!size_) return nullptr;
+        uint64_t hash = Hash(key);
+        for (size_t i = hash & mask_; slots_[i].record; i = (i + 1) & mask_) {
+            if (slots_[i].hash == hash && KeyOf{}(*slots_[i].record) == key) return slots_[i].record;
+        }
+        return nullptr;
+    }
+
+    // Все записи с ключом
+    template <typename Func>
+    void ForEach(std::string_view key, Func&& func) const {
+        if (!size_) return;
+        uint64_t hash = Hash(key);
+        for (size_t i = hash & mask_; slots_[i].record; i = (i + 1) & mask_) {
+            if (slots_[i].hash == hash && KeyOf{}(*slots_[i].record) == key) func(slots_[i].record);
+        }
+    }
+
+    void Clear() {
+        slots_.clear();
+        mask_ = 0;
+        size_ = 0;
+    }
+
+    size_t Size() const { return size_; }
+    size_t MemoryBytes() const { return slots_.capacity() * sizeof(Slot); }
+};
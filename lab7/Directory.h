@@ -5,55 +5,129 @@
 #include <memory>
 #include <algorithm>
 #include <functional> // Для std::function
+#include <string_view>
+#include <cstring>
+#include <charconv>
+#include <new>
+#include "ContactIndex.h"
+#include "ContactArena.h"
+#include "SortKeys.h"
+#include "ParallelSort.h"
+#include "SortedView.h"
+#include "SearchIndex.h"
 
 // --- 1. Базовый класс Модели и Наследники (Contact) ---
 
+// Строки контакта; сами символы хранятся вне объекта
+struct ContactFields {
+    std::string_view name;
+    std::string_view phone;
+    std::string_view address;
+    std::string_view phoneKey;
+    std::string_view extra; // Форма собственности юр. лица или e-mail физ. лица
+};
+
+class Directory;
+
 class Contact {
 protected:
-    std::string name_;
-    std::string phone_;
-    std::string address_;
+    std::string_view name_;
+    std::string_view phone_;
+    std::string_view address_;
+    std::string_view phoneKey_; // Нормализованный телефон — ключ индекса
+    std::string_view extra_;
+    // Все строки контакта одним блоком (одно выделение); nullptr — строки в арене справочника
+    std::unique_ptr<char[]> storage_;
+    // Сам объект размещен в арене справочника: освобождается вместе с ней, не через delete
+    bool inArena_ = false;
+
+    Contact(std::string_view name, std::string_view phone, std::string_view address, std::string_view extra)
+        : storage_(new char[name.size() + 2 * phone.size() + address.size() + extra.size()]) {
+        char* cursor = storage_.get();
+        auto copy = [&cursor](std::string_view text) {
+            if (!text.empty()) std::memcpy(cursor, text.data(), text.size());
+            cursor += text.size();
+            return std::string_view(cursor - text.size(), text.size());
+        };
+        name_ = copy(name);
+        phone_ = copy(phone);
+        address_ = copy(address);
+        extra_ = copy(extra);
+        phoneKey_ = std::string_view(cursor, NormalizePhone(phone, cursor, phone.size()));
+    }
+
+    // Строки не копируются: ими владеет арена справочника. Такой контакт создает
+    // только справочник, размещая его в той же арене
+    explicit Contact(const ContactFields& fields)
+        : name_(fields.name), phone_(fields.phone), address_(fields.address), phoneKey_(fields.phoneKey),
+          extra_(fields.extra), inArena_(true) {}
+
+    friend class Directory;
 
 public:
-    Contact(const std::string& name, const std::string& phone, const std::string& address)
-        : name_(name), phone_(phone), address_(address) {}
-    
+    Contact(std::string_view name, std::string_view phone, std::string_view address)
+        : Contact(name, phone, address, std::string_view()) {}
+
+    // Копия всегда владеет своими строками
+    Contact(const Contact& other) : Contact(other.name_, other.phone_, other.address_, other.extra_) {}
+    Contact& operator=(const Contact&) = delete;
+
     virtual ~Contact() = default;
     
     // Геттеры для доступа к полям (необходимы для стратегий сортировки)
-    const std::string& GetName() const { return name_; }
-    const std::string& GetPhone() const { return phone_; }
-    const std::string& GetAddress() const { return address_; }
+    std::string_view GetName() const { return name_; }
+    std::string_view GetPhone() const { return phone_; }
+    std::string_view GetAddress() const { return address_; }
+    std::string_view GetPhoneKey() const { return phoneKey_; }
+    bool InArena() const { return inArena_; }
+
+    // Дописывает полную информацию о контакте в буфер (без временных строк)
+    virtual void AppendTo(std::string& out) const {
+        out.append("Name: ").append(name_).append(", Phone: ").append(phone_).append(", Address: ").append(address_);
+    }
 
-    // Виртуальный метод для получения полной информации о контакте
-    virtual std::string ToString() const {
-        return "Name: " + name_ + ", Phone: " + phone_ + ", Address: " + address_;
+    // Полная информация о контакте отдельной строкой
+    std::string ToString() const {
+        std::string text;
+        AppendTo(text);
+        return text;
     }
 };
 
 class LegalContact : public Contact {
 private:
-    std::string legal_form_; // Например, ООО, АО
+    explicit LegalContact(const ContactFields& fields) : Contact(fields) {}
+
+    friend class Directory;
 
 public:
-    LegalContact(const std::string& name, const std::string& phone, const std::string& address, const std::string& legalForm)
-        : Contact(name, phone, address), legal_form_(legalForm) {}
+    // Форма собственности, например, ООО, АО
+    LegalContact(std::string_view name, std::string_view phone, std::string_view address, std::string_view legalForm)
+        : Contact(name, phone, address, legalForm) {}
+
+    std::string_view GetLegalForm() const { return extra_; }
 
-    std::string ToString() const override {
-        return Contact::ToString() + ", Type: Legal (" + legal_form_ + ")";
+    void AppendTo(std::string& out) const override {
+        Contact::AppendTo(out);
+        out.append(", Type: Legal (").append(extra_).append(")");
     }
 };
 
 class PhysicalContact : public Contact {
 private:
-    std::string personal_email_;
+    explicit PhysicalContact(const ContactFields& fields) : Contact(fields) {}
+
+    friend class Directory;
 
 public:
-    PhysicalContact(const std::string& name, const std::string& phone, const std::string& address, const std::string& email)
-        : Contact(name, phone, address), personal_email_(email) {}
+    PhysicalContact(std::string_view name, std::string_view phone, std::string_view address, std::string_view email)
+        : Contact(name, phone, address, email) {}
 
-    std::string ToString() const override {
-        return Contact::ToString() + ", Type: Physical, Email: " + personal_email_;
+    std::string_view GetEmail() const { return extra_; }
+
+    void AppendTo(std::string& out) const override {
+        Contact::AppendTo(out);
+        out.append(", Type: Physical, Email: ").append(extra_);
     }
 };
 
@@ -63,17 +137,27 @@ public:
 class ISortStrategy {
 public:
     virtual ~ISortStrategy() = default;
-    // Метод для выполнения алгоритма сортировки
+    // Метод для выполнения алгоритма сортировки. Сортировка устойчива: равные
+    // записи сохраняют порядок добавления (на это опирается SortedView)
     virtual void Sort(std::vector<Contact*>& records) const = 0;
     virtual std::string GetName() const = 0;
 };
 
+// Стратегия, порядок которой справочник может поддерживать инкрементально
+// (SortedView): кроме сортировки массива, сравнивает пару записей
+class IIncrementalSortStrategy : public ISortStrategy {
+public:
+    // Тот же порядок, что у Sort (слияние новых записей в поддерживаемый порядок)
+    virtual bool Less(const Contact* a, const Contact* b) const = 0;
+};
+
 // Конкретная Стратегия A: Сортировка по имени (Name)
-class SortByNameStrategy : public ISortStrategy {
+class SortByNameStrategy : public IIncrementalSortStrategy {
 public:
     std::string GetName() const override { return "by Name"; }
+    bool Less(const Contact* a, const Contact* b) const override { return a->GetName() < b->GetName(); }
     void Sort(std::vector<Contact*>& records) const override {
-        std::sort(records.begin(), records.end(), 
+        std::stable_sort(records.begin(), records.end(), 
             [](const Contact* a, const Contact* b) {
                 return a->GetName() < b->GetName();
             });
@@ -81,45 +165,320 @@ public:
 };
 
 // Конкретная Стратегия B: Сортировка по телефону (Phone)
-class SortByPhoneStrategy : public ISortStrategy {
+class SortByPhoneStrategy : public IIncrementalSortStrategy {
 public:
     std::string GetName() const override { return "by Phone"; }
+    bool Less(const Contact* a, const Contact* b) const override { return a->GetPhone() < b->GetPhone(); }
     void Sort(std::vector<Contact*>& records) const override {
-        std::sort(records.begin(), records.end(), 
+        std::stable_sort(records.begin(), records.end(), 
             [](const Contact* a, const Contact* b) {
                 return a->GetPhone() < b->GetPhone();
             });
     }
 };
 
+// Стратегии C и D: те же порядки, но сортируется массив кэшированных ключей,
+// а записи переставляются один раз (см. SortKeys.h)
+class CachedSortByNameStrategy : public IIncrementalSortStrategy {
+public:
+    std::string GetName() const override { return "by Name (cached keys)"; }
+    bool Less(const Contact* a, const Contact* b) const override { return a->GetName() < b->GetName(); }
+    void Sort(std::vector<Contact*>& records) const override {
+        SortByCachedKeys(records, [](const Contact* c) { return std::string_view(c->GetName()); });
+    }
+};
+
+class CachedSortByPhoneStrategy : public IIncrementalSortStrategy {
+public:
+    std::string GetName() const override { return "by Phone (cached keys)"; }
+    bool Less(const Contact* a, const Contact* b) const override { return a->GetPhone() < b->GetPhone(); }
+    void Sort(std::vector<Contact*>& records) const override {
+        SortByCachedKeys(records, [](const Contact* c) { return std::string_view(c->GetPhone()); });
+    }
+};
+
+// Стратегии E и F: кэшированные ключи, параллельная сортировка слиянием на пуле потоков
+class ParallelSortByNameStrategy : public IIncrementalSortStrategy {
+private:
+    ThreadPool* pool_;
+public:
+    explicit ParallelSortByNameStrategy(ThreadPool* pool) : pool_(pool) {}
+    std::string GetName() const override { return "by Name (parallel merge, " + std::to_string(pool_->Size()) + " threads)"; }
+    bool Less(const Contact* a, const Contact* b) const override { return a->GetName() < b->GetName(); }
+    void Sort(std::vector<Contact*>& records) const override {
+        ParallelSortByCachedKeys(records, [](const Contact* c) { return std::string_view(c->GetName()); }, *pool_);
+    }
+};
+
+class ParallelSortByPhoneStrategy : public IIncrementalSortStrategy {
+private:
+    ThreadPool* pool_;
+public:
+    explicit ParallelSortByPhoneStrategy(ThreadPool* pool) : pool_(pool) {}
+    std::string GetName() const override { return "by Phone (parallel merge, " + std::to_string(pool_->Size()) + " threads)"; }
+    bool Less(const Contact* a, const Contact* b) const override { return a->GetPhone() < b->GetPhone(); }
+    void Sort(std::vector<Contact*>& records) const override {
+        ParallelSortByCachedKeys(records, [](const Contact* c) { return std::string_view(c->GetPhone()); }, *pool_);
+    }
+};
+
+// Стратегия G: поразрядная сортировка по цифрам нормализованного телефона.
+// Для телефонов одного формата порядок совпадает с SortByPhoneStrategy;
+// разные написания одного номера ("8-901-...", "+7 (901) ...") оказываются рядом
+class RadixSortByPhoneStrategy : public IIncrementalSortStrategy {
+private:
+    ThreadPool* pool_;
+public:
+    explicit RadixSortByPhoneStrategy(ThreadPool* pool = nullptr) : pool_(pool) {}
+    std::string GetName() const override {
+        return "by Phone digits (MSD radix" + (pool_ ? ", " + std::to_string(pool_->Size()) + " threads)" : std::string(")"));
+    }
+    bool Less(const Contact* a, const Contact* b) const override { return a->GetPhoneKey() < b->GetPhoneKey(); }
+    void Sort(std::vector<Contact*>& records) const override {
+        RadixSortByDigits(records, [](const Contact* c) { return std::string_view(c->GetPhoneKey()); }, pool_);
+    }
+};
+
+// Ключи хеш-индексов справочника
+struct ContactNameKey {
+    std::string_view operator()(const Contact& contact) const { return contact.GetName(); }
+};
+
+struct ContactPhoneKey {
+    std::string_view operator()(const Contact& contact) const { return contact.GetPhoneKey(); }
+};
+
+using SortedContactView = SortedView<Contact, IIncrementalSortStrategy>;
+using ContactSearchHit = SearchHit<Contact>;
+
 // --- 3. Контекст (Основной класс) - Directory ---
 
+// Где справочник размещает создаваемые им контакты
+enum class ContactStorage {
+    Heap,  // Каждый контакт — отдельный new
+    Arena  // Контакты и строки — в арене справочника, адреса и формы собственности — в пуле строк
+};
+
 class Directory {
 private:
     std::string title_;
     std::string ownerName_;
     std::vector<Contact*> records_;
+    ContactStorage storage_;
+    ContactArena arena_;
+    StringInterner strings_{arena_};
+    size_t heapRecords_ = 0; // Записи, освобождаемые через delete
     // Поле, хранящее ссылку на экземпляр класса Стратегия
     ISortStrategy* sortStrategy_ = nullptr;
+    // Индексы поиска, синхронизируются в AddContact/RemoveContact
+    ContactHashIndex<Contact, ContactNameKey> nameIndex_;
+    ContactHashIndex<Contact, ContactPhoneKey> phoneIndex_;
+    // Инкрементальный режим: records_ хранит порядок добавления, порядки стратегий
+    // поддерживаются представлениями и строятся заново только для новой стратегии
+    bool incremental_ = false;
+    std::vector<std::unique_ptr<SortedContactView>> views_;
+    // Поиск по мере ввода: строится при первом запросе, далее поддерживается при изменениях
+    PrefixSearchIndex<Contact, ContactNameKey> nameSearch_{true};
+    PrefixSearchIndex<Contact, ContactPhoneKey> phoneSearch_{false};
+    bool searchReady_ = false;
+    // Буфер вывода DisplayRecords, переиспользуется между вызовами
+    static constexpr size_t kDisplayChunk = 64 * 1024;
+    mutable std::string displayBuffer_;
+
+    SortedContactView* FindView(const ISortStrategy* strategy) const {
+        for (const auto& view : views_) {
+            if (view->GetStrategy() == strategy) return view.get();
+        }
+        return nullptr;
+    }
+
+    void EnsureSearchIndex() {
+        if (searchReady_) return;
+        nameSearch_.Build(records_);
+        phoneSearch_.Build(records_);
+        searchReady_ = true;
+    }
+
+    void InsertRecord(Contact* record) {
+        records_.push_back(record);
+        nameIndex_.Add(record);
+        phoneIndex_.Add(record);
+        for (auto& view : views_) view->Insert(record);
+        if (searchReady_) {
+            nameSearch_.Add(record);
+            phoneSearch_.Add(record);
+        }
+        std::cout << "[Directory] Added contact: " << record->GetName() << std::endl;
+    }
+
+    // Строки нового контакта арены: уникальные копируются, повторяющиеся берутся из пула
+    ContactFields ArenaFields(std::string_view name, std::string_view phone, std::string_view address,
+                              std::string_view extra, bool internExtra) {
+        char* key = static_cast<char*>(arena_.Allocate(phone.size(), 1));
+        return {arena_.CopyString(name), arena_.CopyString(phone), strings_.Intern(address),
+                std::string_view(key, NormalizePhone(phone, key, phone.size())),
+                internExtra ? strings_.Intern(extra) : arena_.CopyString(extra)};
+    }
+
+    // Конструктор из ContactFields доступен только справочнику, поэтому объект
+    // размещается здесь, а не через ContactArena::Create
+    template <typename T>
+    T* CreateInArena(const ContactFields& fields) {
+        return new (arena_.Allocate(sizeof(T), alignof(T))) T(fields);
+    }
+
+    template <typename T>
+    T* CreateRecord(std::string_view name, std::string_view phone, std::string_view address, std::string_view extra,
+                    bool internExtra) {
+        if (storage_ == ContactStorage::Arena) {
+            T* record = CreateInArena<T>(ArenaFields(name, phone, address, extra, internExtra));
+            InsertRecord(record);
+            return record;
+        }
+        T* record = new T(name, phone, address, extra);
+        AddContact(record);
+        return record;
+    }
+
+    // Только цифры и символы записи телефона — ищем по телефонам
+    static bool IsPhoneQuery(std::string_view query) {
+        bool digits = false;
+        for (char c : query) {
+            if (c >= '0' && c <= '9') digits = true;
+            else if (std::string_view("+-() ").find(c) == std::string_view::npos) return false;
+        }
+        return digits;
+    }
 
 public:
-    Directory(const std::string& title, const std::string& ownerName)
-        : title_(title), ownerName_(ownerName) {
+    Directory(const std::string& title, const std::string& ownerName, ContactStorage storage = ContactStorage::Heap)
+        : title_(title), ownerName_(ownerName), storage_(storage) {
         std::cout << "[Directory] Created: " << title_ << std::endl;
     }
     
     ~Directory() {
-        // Освобождение памяти, занятой элементами массива
-        for (auto& record : records_) {
-            delete record;
+        // Освобождение памяти, занятой элементами массива; контакты арены
+        // освобождаются вместе с ней, без обхода записей
+        if (heapRecords_) {
+            for (auto& record : records_) {
+                if (!record->InArena()) delete record;
+            }
         }
         std::cout << "[Directory] Destroyed: " << title_ << std::endl;
     }
 
-    // Метод для добавления записи
+    // Метод для добавления записи (созданной через new; справочник становится владельцем)
     void AddContact(Contact* record) {
-        records_.push_back(record);
-        std::cout << "[Directory] Added contact: " << record->GetName() << std::endl;
+        ++heapRecords_;
+        InsertRecord(record);
+    }
+
+    // Создание записи справочником: в режиме арены — без отдельных выделений памяти
+    Contact* AddContact(std::string_view name, std::string_view phone, std::string_view address) {
+        if (storage_ == ContactStorage::Heap) {
+            Contact* record = new Contact(name, phone, address);
+            AddContact(record);
+            return record;
+        }
+        Contact* record = CreateInArena<Contact>(ArenaFields(name, phone, address, {}, false));
+        InsertRecord(record);
+        return record;
+    }
+
+    LegalContact* AddLegalContact(std::string_view name, std::string_view phone, std::string_view address,
+                                  std::string_view legalForm) {
+        return CreateRecord<LegalContact>(name, phone, address, legalForm, true);
+    }
+
+    PhysicalContact* AddPhysicalContact(std::string_view name, std::string_view phone, std::string_view address,
+                                        std::string_view email) {
+        return CreateRecord<PhysicalContact>(name, phone, address, email, false);
+    }
+
+    // Удаление записи (индексы — O(1), массив записей сохраняет порядок и сдвигается)
+    bool RemoveContact(const Contact* record) {
+        if (!record || !nameIndex_.Remove(record)) return false;
+        phoneIndex_.Remove(record);
+        for (auto& view : views_) view->Remove(record);
+        if (searchReady_) {
+            nameSearch_.Remove(record);
+            phoneSearch_.Remove(record);
+        }
+        records_.erase(std::find(records_.begin(), records_.end(), record));
+        std::cout << "[Directory] Removed contact: " << record->GetName() << std::endl;
+        // Память контакта арены освобождается вместе с ней
+        if (!record->InArena()) {
+            --heapRecords_;
+            delete record;
+        }
+        return true;
+    }
+
+    // Резерв под ожидаемое число записей (без перестроения индексов при загрузке)
+    void Reserve(size_t count) {
+        records_.reserve(count);
+        nameIndex_.Reserve(count);
+        phoneIndex_.Reserve(count);
+    }
+
+    // --- Поиск за O(1) без выделения памяти ---
+    Contact* FindByName(std::string_view name) const { return nameIndex_.Find(name); }
+
+    template <typename Func>
+    void ForEachByName(std::string_view name, Func&& func) const { nameIndex_.ForEach(name, func); }
+
+    // Телефон в любом написании: "8-901-123-4567", "+7 (901) 123-45-67"
+    Contact* FindByPhone(std::string_view phone) const {
+        char digits[32];
+        size_t length = NormalizePhone(phone, digits, sizeof(digits));
+        return length ? phoneIndex_.Find(std::string_view(digits, length)) : nullptr;
+    }
+
+    size_t Size() const { return records_.size(); }
+    ContactStorage GetStorage() const { return storage_; }
+    const ContactArena& GetArena() const { return arena_; }
+    size_t GetInternedStrings() const { return strings_.Size(); }
+
+    // --- Поиск по мере ввода ---
+    // Имя — по началу любого слова без учета регистра ASCII; телефон — по началу
+    // нормализованного номера ("8-901", "+7 (901", "901" без кода не находится)
+    std::vector<ContactSearchHit> SearchByPrefix(std::string_view query, size_t limit = 10) {
+        EnsureSearchIndex();
+        std::vector<ContactSearchHit> hits;
+        if (!IsPhoneQuery(query)) {
+            nameSearch_.Prefix(query, limit, hits);
+            return hits;
+        }
+        std::string digits = NormalizePhone(query);
+        phoneSearch_.Prefix(digits, limit, hits);
+        // Ведущая 8 набранного префикса — тот же номер с 7 (см. NormalizePhone)
+        if (digits[0] == '8' && hits.size() < limit) {
+            std::vector<ContactSearchHit> normalized;
+            digits[0] = '7';
+            phoneSearch_.Prefix(digits, limit - hits.size(), normalized);
+            hits.insert(hits.begin(), normalized.begin(), normalized.end());
+        }
+        return hits;
+    }
+
+    // Префикс с опечатками: не больше maxDistance вставок, удалений и замен.
+    // Лучшие совпадения первыми
+    std::vector<ContactSearchHit> SearchFuzzy(std::string_view query, size_t maxDistance = 1, size_t limit = 10) {
+        EnsureSearchIndex();
+        std::vector<ContactSearchHit> hits;
+        if (IsPhoneQuery(query)) {
+            std::string digits = NormalizePhone(query);
+            if (digits[0] == '8') digits[0] = '7';
+            phoneSearch_.Fuzzy(digits, maxDistance, limit, hits);
+        } else {
+            nameSearch_.Fuzzy(query, maxDistance, limit, hits);
+        }
+        return hits;
+    }
+
+    size_t GetSearchIndexBytes() {
+        EnsureSearchIndex();
+        return nameSearch_.MemoryBytes() + phoneSearch_.MemoryBytes();
     }
 
     // Метод для установки стратегии (динамическая смена поведения)
@@ -134,17 +493,66 @@ public:
             std::cout << "[Directory] Error: Sorting strategy is not set. Cannot sort." << std::endl;
             return;
         }
+        // Стратегия без сравнения пары записей сортирует массив, как без инкрементального режима
+        auto* maintained = incremental_ ? dynamic_cast<const IIncrementalSortStrategy*>(sortStrategy_) : nullptr;
+        if (maintained) {
+            // Полная сортировка — только если порядок этой стратегии еще не поддерживается
+            bool rebuilt = !FindView(maintained);
+            GetSortedView(maintained);
+            std::cout << "[Directory] Sorted view " << sortStrategy_->GetName() << (rebuilt ? " built." : " is up to date.")
+                      << std::endl;
+            return;
+        }
         // Делегируем алгоритм текущей стратегии
         sortStrategy_->Sort(records_);
         std::cout << "[Directory] Records successfully sorted " << sortStrategy_->GetName() << "." << std::endl;
     }
-    
-    // Вывод записей
-    void DisplayRecords() const {
-        std::cout << "\n=== Directory: " << title_ << " (Owner: " << ownerName_ << ") ===" << std::endl;
-        for (size_t i = 0; i < records_.size(); ++i) {
-            std::cout << "[" << i + 1 << "] " << records_[i]->ToString() << std::endl;
+
+    // Включение/выключение инкрементального режима; при выключении представления удаляются
+    void SetIncrementalSort(bool enabled) {
+        incremental_ = enabled;
+        if (!enabled) views_.clear();
+    }
+
+    // Поддерживаемый порядок стратегии; строится при первом запросе.
+    // Несколько порядков (по имени, по телефону) могут поддерживаться одновременно
+    SortedContactView& GetSortedView(const IIncrementalSortStrategy* strategy) {
+        if (SortedContactView* view = FindView(strategy)) return *view;
+        views_.push_back(std::make_unique<SortedContactView>(strategy, records_));
+        return *views_.back();
+    }
+
+    void DropSortedView(const ISortStrategy* strategy) {
+        views_.erase(std::remove_if(views_.begin(), views_.end(),
+                                    [&](const auto& view) { return view->GetStrategy() == strategy; }),
+                     views_.end());
+    }
+
+    // Вывод записей (в инкрементальном режиме — в порядке текущей стратегии)
+    // Список собирается в буфере справочника и выводится крупными блоками, один flush в конце
+    void DisplayRecords(std::ostream& out = std::cout) const {
+        std::string& buffer = displayBuffer_;
+        buffer.clear();
+        buffer.append("\n=== Directory: ").append(title_).append(" (Owner: ").append(ownerName_).append(") ===\n");
+        size_t i = 0;
+        auto print = [&](const Contact* record) {
+            char number[24];
+            char* end = std::to_chars(number, number + sizeof(number), ++i).ptr;
+            buffer.append("[").append(number, end).append("] ");
+            record->AppendTo(buffer);
+            buffer.push_back('\n');
+            if (buffer.size() >= kDisplayChunk) {
+                out.write(buffer.data(), buffer.size());
+                buffer.clear(); // Емкость сохраняется
+            }
+        };
+        if (SortedContactView* view = incremental_ ? FindView(sortStrategy_) : nullptr) {
+            view->ForEach(print);
+        } else {
+            for (const Contact* record : records_) print(record);
         }
-        std::cout << "---------------------------------------" << std::endl;
+        buffer.append("---------------------------------------\n");
+        out.write(buffer.data(), buffer.size());
+        out.flush();
     }
 };
\ No newline at end of file
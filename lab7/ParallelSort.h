@@ -0,0 +1,231 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include "SortKeys.h"
+
+// --- Параллельная сортировка и поразрядная сортировка телефонов ---
+// Оба алгоритма сортируют компактные ключи с исходным индексом, поэтому
+// результат устойчив и не зависит от числа потоков и расписания задач.
+
+// Пул потоков с очередью задач и параллельным циклом «разветвление-слияние»
+class ThreadPool {
+private:
+    std::vector<std::thread> workers_;
+    std::queue<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_ = false;
+
+public:
+    explicit ThreadPool(size_t threadCount) {
+        for (size_t i = 0; i < std::max<size_t>(1, threadCount); ++i) {
+            workers_.emplace_back([this] {
+                for (;;) {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        cv_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+                        if (stopping_ && tasks_.empty()) return;
+                        task = std::move(tasks_.front());
+                        tasks_.pop();
+                    }
+                    task();
+                }
+            });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        for (auto& worker : workers_) worker.join();
+    }
+
+    void Submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push(std::move(task));
+        }
+        cv_.notify_one();
+    }
+
+    // func(i) для i в [0, count); индексы раздаются атомарным счетчиком, возврат — после всех.
+    // Вызывать из потока вне пула
+    template <typename Func>
+    void ParallelFor(size_t count, Func func) {
+        if (count == 0) return;
+        std::atomic<size_t> next{0};
+        size_t runners = std::min(count, workers_.size());
+        size_t finished = 0;
+        std::mutex doneMutex;
+        std::condition_variable done;
+        for (size_t r = 0; r < runners; ++r) {
+            Submit([&] {
+                for (size_t i; (i = next.fetch_add(1)) < count;) func(i);
+                std::lock_guard<std::mutex> lock(doneMutex);
+                if (++finished == runners) done.notify_one();
+            });
+        }
+        std::unique_lock<std::mutex> lock(doneMutex);
+        done.wait(lock, [&] { return finished == runners; });
+    }
+
+    size_t Size() const { return workers_.size(); }
+};
+
+// Параллельная сортировка слиянием ключей SortKey: блоки сортируются
+// независимо, затем попарно сливаются; каждое слияние делится на части по
+// диагоналям пути слияния (merge path), так что все потоки заняты до последнего уровня
+template <typename Record, typename KeyOf>
+void ParallelSortByCachedKeys(std::vector<Record*>& records, KeyOf keyOf, ThreadPool& pool) {
+    size_t n = records.size();
+    size_t tasks = pool.Size() * 4;
+    size_t blocks = std::max<size_t>(1, std::min(tasks, n / 4096));
+    std::vector<SortKey> keys(n), buffer(n);
+    std::vector<size_t> bounds(blocks + 1);
+    for (size_t b = 0; b <= blocks; ++b) bounds[b] = n * b / blocks;
+
+    pool.ParallelFor(blocks, [&](size_t b) {
+        for (size_t i = bounds[b]; i < bounds[b + 1]; ++i) {
+            std::string_view key = keyOf(records[i]);
+            keys[i] = {LoadKeyChunk(key, 0), LoadKeyChunk(key, 8), static_cast<uint32_t>(key.size()), static_cast<uint32_t>(i)};
+        }
+        std::sort(keys.begin() + bounds[b], keys.begin() + bounds[b + 1]);
+    });
+
+    // Уровни слияния: отрезки [bounds[2m], bounds[2m+1]) и [bounds[2m+1], bounds[2m+2])
+    while (bounds.size() > 2) {
+        size_t merges = (bounds.size() - 1) / 2;
+        bool oddTail = (bounds.size() - 1) % 2 == 1;
+        size_t parts = std::max<size_t>(1, tasks / merges);
+        pool.ParallelFor(merges * parts + (oddTail ? 1 : 0), [&](size_t t) {
+            if (t == merges * parts) { // Непарный последний отрезок копируется как есть
+                std::copy(keys.begin() + bounds[bounds.size() - 2], keys.end(), buffer.begin() + bounds[bounds.size() - 2]);
+                return;
+            }
+            size_t m = t / parts, part = t % parts;
+            const SortKey* a = keys.data() + bounds[2 * m];
+            const SortKey* b = keys.data() + bounds[2 * m + 1];
+            size_t aSize = bounds[2 * m + 1] - bounds[2 * m], bSize = bounds[2 * m + 2] - bounds[2 * m + 1];
+            // Диагональ d: сколько первых элементов результата взять из a (ключи попарно различны)
+            auto split = [&](size_t d) {
+                size_t lo = d > bSize ? d - bSize : 0, hi = std::min(d, aSize);
+                while (lo < hi) {
+                    size_t mid = (lo + hi) / 2;
+                    if (a[mid] < b[d - mid - 1]) lo = mid + 1;
+                    else hi = mid;
+                }
+                return lo;
+            };
+            size_t from = (aSize + bSize) * part / parts, to = (aSize + bSize) * (part + 1) / parts;
+            size_t ai = split(from), aj = split(to);
+            std::merge(a + ai, a + aj, b + (from - ai), b + (to - aj), buffer.begin() + bounds[2 * m] + from);
+        });
+        keys.swap(buffer);
+        std::vector<size_t> next;
+        for (size_t i = 0; i < bounds.size(); i += 2) next.push_back(bounds[i]);
+        if (next.back() != n) next.push_back(n);
+        bounds.swap(next);
+    }
+
+    RefineKeyRuns(records, keyOf, keys.data(), keys.data() + n, 0);
+
+    std::vector<Record*> sorted(n);
+    pool.ParallelFor(blocks, [&](size_t b) {
+        for (size_t i = n * b / blocks; i < n * (b + 1) / blocks; ++i) sorted[i] = records[keys[i].index];
+    });
+    records.swap(sorted);
+}
+
+// --- Поразрядная сортировка (MSD) по цифрам телефона ---
+// Нормализованный телефон упаковывается в uint64_t по 4 бита на цифру, старшая
+// цифра — в старших битах; 0 — «цифры кончились», поэтому сравнение чисел
+// совпадает со сравнением строк цифр. Номера длиннее 16 цифр при равенстве
+// первых 16 досортировываются по полной строке.
+
+struct DigitKey {
+    uint64_t packed;
+    uint32_t length;
+    uint32_t index;
+};
+
+inline constexpr size_t kPackedDigits = 16;
+
+inline uint64_t PackDigits(std::string_view digits) {
+    uint64_t packed = 0;
+    for (size_t i = 0; i < kPackedDigits; ++i) {
+        packed = (packed << 4) | (i < digits.size() ? static_cast<uint64_t>(digits[i] - '0' + 1) : 0);
+    }
+    return packed;
+}
+
+// Устойчивое распределение по 16 корзинам текущей цифры через буфер; одинаковые
+// на всех ключах цифры пропускаются без перемещений. Корзины крупного верхнего
+// уровня сортируются параллельно
+inline void RadixSortDigits(DigitKey* keys, DigitKey* scratch, size_t n, int shift, ThreadPool* pool) {
+    while (shift >= 0) {
+        if (n <= 32) { // Вставками: устойчиво
+            for (size_t i = 1; i < n; ++i) {
+                DigitKey key = keys[i];
+                size_t j = i;
+                for (; j > 0 && keys[j - 1].packed > key.packed; --j) keys[j] = keys[j - 1];
+                keys[j] = key;
+            }
+            return;
+        }
+        size_t count[16] = {};
+        for (size_t i = 0; i < n; ++i) ++count[(keys[i].packed >> shift) & 15];
+        if (std::count(count, count + 16, size_t(0)) == 15) { // Общая цифра у всех
+            shift -= 4;
+            continue;
+        }
+        size_t start[17] = {};
+        for (int d = 0; d < 16; ++d) start[d + 1] = start[d] + count[d];
+        size_t offset[16];
+        std::copy(start, start + 16, offset);
+        for (size_t i = 0; i < n; ++i) scratch[offset[(keys[i].packed >> shift) & 15]++] = keys[i];
+        std::copy(scratch, scratch + n, keys);
+        if (shift == 0) return;
+        auto bucket = [&](size_t d) {
+            if (count[d] > 1) RadixSortDigits(keys + start[d], scratch + start[d], count[d], shift - 4, nullptr);
+        };
+        if (pool && n > 65536) pool->ParallelFor(16, bucket);
+        else for (size_t d = 0; d < 16; ++d) bucket(d);
+        return;
+    }
+}
+
+template <typename Record, typename DigitsOf>
+void RadixSortByDigits(std::vector<Record*>& records, DigitsOf digitsOf, ThreadPool* pool = nullptr) {
+    size_t n = records.size();
+    std::vector<DigitKey> keys(n), scratch(n);
+    for (size_t i = 0; i < n; ++i) {
+        std::string_view digits = digitsOf(records[i]);
+        keys[i] = {PackDigits(digits), static_cast<uint32_t>(digits.size()), static_cast<uint32_t>(i)};
+    }
+    RadixSortDigits(keys.data(), scratch.data(), n, 4 * (kPackedDigits - 1), pool);
+
+    // Равные первые 16 цифр у длинных номеров — досортировка по полной строке
+    for (size_t run = 0; run < n;) {
+        size_t end = run + 1;
+        bool longer = keys[run].length > kPackedDigits;
+        while (end < n && keys[end].packed == keys[run].packed) longer |= keys[end++].length > kPackedDigits;
+        if (end - run > 1 && longer) {
+            std::stable_sort(keys.begin() + run, keys.begin() + end, [&](const DigitKey& a, const DigitKey& b) {
+                return digitsOf(records[a.index]) < digitsOf(records[b.index]);
+            });
+        }
+        run = end;
+    }
+
+    std::vector<Record*> sorted(n);
+    for (size_t i = 0; i < n; ++i) sorted[i] = records[keys[i].index];
+    records.swap(sorted);
+}
@@ -0,0 +1,340 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// --- Поиск по мере ввода: префиксный и нечеткий ---
+// Индекс — отсортированный массив «суффиксов с начала слова»: для имени
+// "Ivanov P.I." хранятся ключи "ivanov p.i." и "p.i.", поэтому запрос находит
+// контакт по любому слову. Сами строки (в нижнем регистре ASCII) лежат одним
+// буфером, элемент массива — смещение, длина и указатель на запись (16 байт).
+// Префиксный запрос — двоичный поиск и обход диапазона, O(log n + k).
+// Нечеткий запрос — расстояние редактирования от запроса до ближайшего префикса
+// ключа (опечатки в уже набранной части), не больше maxDistance. Столбцы таблицы
+// расстояний считаются бит-параллельным алгоритмом Майерса (строка запроса — в
+// битах uint64_t). Отсортированный массив обходится как префиксное дерево:
+// столбцы общего начала соседних ключей не пересчитываются, а как только минимум
+// столбца превысил maxDistance, расстояние для всех ключей с этим началом уже
+// известно и они пропускаются галопом. Просматриваются только ветви в пределах
+// maxDistance от запроса, а не все ключи.
+// Изменения поддерживаются как в SortedView: ключи новой записи попадают в
+// небольшой отсортированный буфер, который сливается с основным массивом при
+// росте до ~sqrt(n); ключи удаленной записи помечаются и вычищаются при слиянии.
+
+template <typename Record>
+struct SearchHit {
+    Record* record;
+    uint32_t distance; // 0 для префиксного поиска
+};
+
+inline constexpr size_t kMaxFuzzyQuery = 64;   // Длина запроса — одно слово uint64_t
+inline constexpr size_t kMaxFuzzyDistance = 8;
+
+inline char FoldChar(char c) { return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c; }
+
+// Столбец таблицы расстояний между запросом (m символов) и префиксом ключа в
+// кодировке Майерса: pv/mv — приращения +1/-1 сверху вниз, score — значение в
+// последней строке, best — минимум score по пройденным столбцам
+struct MyersColumn {
+    uint64_t pv, mv;
+    uint32_t score, best;
+
+    static MyersColumn First(size_t m) { return {~0ull, 0, static_cast<uint32_t>(m), static_cast<uint32_t>(m)}; }
+
+    // Столбец для следующего символа ключа; eq — позиции этого символа в запросе
+    MyersColumn Next(uint64_t eq, uint64_t last) const {
+        uint64_t xv = eq | mv;
+        uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        uint64_t ph = mv | ~(xh | pv);
+        uint64_t mh = pv & xh;
+        uint32_t next = score + ((ph & last) != 0) - ((mh & last) != 0);
+        ph = (ph << 1) | 1; // Граница D[0][j] = j: пропуск символов ключа стоит
+        mh <<= 1;
+        return {mh | ~(xv | ph), ph & xv, next, std::min(best, next)};
+    }
+
+    // Минимум столбца j (D[0][j] = j). Минимумы столбцов не убывают с ростом j
+    uint32_t Min(size_t j, size_t m) const {
+        int32_t value = static_cast<int32_t>(j), low = value;
+        for (size_t i = 0; i < m; ++i) {
+            value += static_cast<int32_t>((pv >> i) & 1) - static_cast<int32_t>((mv >> i) & 1);
+            low = std::min(low, value);
+        }
+        return static_cast<uint32_t>(low);
+    }
+};
+
+template <typename Record, typename KeyOf>
+class PrefixSearchIndex {
+private:
+    struct Entry {
+        uint32_t offset; // Начало ключа в text_
+        uint32_t length;
+        Record* record;  // nullptr — запись удалена, ключ вычищается при слиянии
+    };
+
+    bool wordStarts_;
+    std::vector<char> text_;
+    std::vector<Entry> entries_;
+    std::vector<Entry> delta_; // Отсортирован; ключи новее всех в entries_
+    size_t removed_ = 0;       // Помеченные элементы entries_
+    size_t garbage_ = 0;       // Байты text_ удаленных записей
+
+    std::string_view Key(const Entry& entry) const { return std::string_view(text_.data() + entry.offset, entry.length); }
+
+    // Равные ключи — в порядке добавления записей
+    bool Less(const Entry& a, const Entry& b) const {
+        int order = Key(a).compare(Key(b));
+        return order != 0 ? order < 0 : a.offset < b.offset;
+    }
+
+    size_t DeltaLimit() const {
+        return std::max<size_t>(64, static_cast<size_t>(std::sqrt(static_cast<double>(entries_.size()))));
+    }
+
+    static std::string Fold(std::string_view text) {
+        std::string folded(text);
+        std::transform(folded.begin(), folded.end(), folded.begin(), FoldChar);
+        return folded;
+    }
+
+    // Строка ключа записи в text_, затем по элементу на каждое начало слова
+    template <typename Push>
+    void AppendKeys(Record* record, Push&& push) {
+        std::string_view key = KeyOf{}(*record);
+        uint32_t offset = static_cast<uint32_t>(text_.size());
+        std::transform(key.begin(), key.end(), std::back_inserter(text_), FoldChar);
+        for (size_t i = 0; i < key.size(); ++i) {
+            bool wordStart = i == 0 || (wordStarts_ && key[i - 1] == ' ' && key[i] != ' ');
+            if (wordStart) push(Entry{offset + static_cast<uint32_t>(i), static_cast<uint32_t>(key.size() - i), record});
+        }
+    }
+
+    typename std::vector<Entry>::const_iterator LowerBound(const std::vector<Entry>& entries, std::string_view key) const {
+        return std::lower_bound(entries.begin(), entries.end(), key,
+                                [this](const Entry& entry, std::string_view k) { return Key(entry) < k; });
+    }
+
+    // Элемент записи с ключом key в entries (среди равных ключей — линейно)
+    Entry* FindEntry(std::vector<Entry>& entries, std::string_view key, const Record* record) {
+        for (auto it = entries.begin() + (LowerBound(entries, key) - entries.begin());
+             it != entries.end() && Key(*it) == key; ++it) {
+            if (it->record == record) return &*it;
+        }
+        return nullptr;
+    }
+
+    static bool Contains(const std::vector<SearchHit<Record>>& hits, const Record* record) {
+        for (const auto& hit : hits) {
+            if (hit.record == record) return true;
+        }
+        return false;
+    }
+
+    static bool Contains(const std::vector<const Entry*>& bucket, const Record* record) {
+        for (const Entry* entry : bucket) {
+            if (entry->record == record) return true;
+        }
+        return false;
+    }
+
+    // Конец диапазона от begin, в котором выполняется inRange (галопом, затем
+    // двоичным поиском): O(log длины диапазона)
+    template <typename InRange>
+    static size_t RangeEnd(size_t begin, size_t size, InRange&& inRange) {
+        size_t step = 1;
+        while (begin + step < size && inRange(begin + step)) {
+            begin += step;
+            step *= 2;
+        }
+        size_t lo = begin + 1, hi = std::min(begin + step, size);
+        while (lo < hi) {
+            size_t mid = (lo + hi) / 2;
+            if (inRange(mid)) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo;
+    }
+
+    // Обход отсортированных ключей как префиксного дерева: для каждого диапазона
+    // ключей с расстоянием <= k вызывается found(begin, end, distance)
+    template <typename Found>
+    void FuzzyWalk(const std::vector<Entry>& entries, const uint64_t* peq, size_t m, size_t k, Found&& found) const {
+        // Минимум столбца j не меньше j - m: глубже m + k + 1 обход не спускается
+        MyersColumn path[kMaxFuzzyQuery + kMaxFuzzyDistance + 2];
+        path[0] = MyersColumn::First(m);
+        uint64_t last = 1ull << (m - 1);
+        std::string_view previous;
+        size_t valid = 0; // Столбцы path[0..valid] посчитаны для previous
+        for (size_t i = 0; i < entries.size();) {
+            std::string_view key = Key(entries[i]);
+            size_t depth = 0, shared = std::min(valid, key.size());
+            while (depth < shared && key[depth] == previous[depth]) ++depth;
+            for (;; ++depth) {
+                const MyersColumn& column = path[depth];
+                // Ключ кончился — расстояние известно для него и равных ему;
+                // минимум столбца больше k — для всех ключей с этим началом
+                bool exhausted = depth == key.size();
+                if (exhausted || column.Min(depth, m) > k) {
+                    std::string_view head = key.substr(0, depth);
+                    size_t end = RangeEnd(i, entries.size(), [&](size_t e) {
+                        std::string_view other = Key(entries[e]);
+                        return exhausted ? other == head : other.substr(0, depth) == head;
+                    });
+                    if (column.best <= k) found(i, end, column.best);
+                    i = end;
+                    break;
+                }
+                path[depth + 1] = column.Next(peq[static_cast<unsigned char>(key[depth])], last);
+            }
+            previous = key;
+            valid = depth;
+        }
+    }
+
+    // Слияние буфера с основным массивом; помеченные ключи выбрасываются
+    void Merge() {
+        if (removed_) {
+            entries_.erase(std::remove_if(entries_.begin(), entries_.end(), [](const Entry& e) { return !e.record; }),
+                           entries_.end());
+            removed_ = 0;
+        }
+        size_t middle = entries_.size();
+        entries_.insert(entries_.end(), delta_.begin(), delta_.end());
+        std::inplace_merge(entries_.begin(), entries_.begin() + middle, entries_.end(),
+                           [this](const Entry& a, const Entry& b) { return Less(a, b); });
+        delta_.clear();
+        if (garbage_ * 2 > text_.size()) CompactText();
+    }
+
+    // Уплотнение строк: все ключи записи кончаются в одной позиции text_, поэтому
+    // живая часть строки записи — от наименьшего смещения ее ключей до этого конца.
+    // Порядок смещений сохраняется, а с ним и порядок равных ключей
+    void CompactText() {
+        std::vector<uint32_t> order(entries_.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) { return entries_[a].offset < entries_[b].offset; });
+        std::vector<char> text;
+        text.reserve(text_.size() - garbage_);
+        for (size_t n = 0; n < order.size();) {
+            uint32_t begin = entries_[order[n]].offset, end = begin + entries_[order[n]].length;
+            uint32_t base = static_cast<uint32_t>(text.size());
+            text.insert(text.end(), text_.begin() + begin, text_.begin() + end);
+            for (; n < order.size() && entries_[order[n]].offset + entries_[order[n]].length == end; ++n) {
+                entries_[order[n]].offset = base + (entries_[order[n]].offset - begin);
+            }
+        }
+        text_.swap(text);
+        garbage_ = 0;
+    }
+
+public:
+    // wordStarts — индексировать каждое слово ключа (имена), иначе только ключ целиком (телефоны)
+    explicit PrefixSearchIndex(bool wordStarts) : wordStarts_(wordStarts) {}
+
+    void Build(const std::vector<Record*>& records) {
+        text_.clear();
+        entries_.clear();
+        delta_.clear();
+        removed_ = garbage_ = 0;
+        for (Record* record : records) AppendKeys(record, [this](const Entry& entry) { entries_.push_back(entry); });
+        std::sort(entries_.begin(), entries_.end(), [this](const Entry& a, const Entry& b) { return Less(a, b); });
+    }
+
+    // Ключи новой записи — в буфер, O(sqrt(n)) амортизированно
+    void Add(Record* record) {
+        AppendKeys(record, [this](const Entry& entry) {
+            // После равных: более новая запись идет позже
+            delta_.insert(std::upper_bound(delta_.begin(), delta_.end(), entry,
+                                           [this](const Entry& a, const Entry& b) { return Less(a, b); }),
+                          entry);
+        });
+        if (delta_.size() > DeltaLimit()) Merge();
+    }
+
+    // Ключи записи удаляются из буфера или помечаются в основном массиве.
+    // Запись должна быть жива: ее ключи вычисляются заново
+    bool Remove(const Record* record) {
+        std::string key = Fold(KeyOf{}(*record));
+        bool found = false;
+        for (size_t i = 0; i < key.size(); ++i) {
+            if (i > 0 && !(wordStarts_ && key[i - 1] == ' ' && key[i] != ' ')) continue;
+            std::string_view word = std::string_view(key).substr(i);
+            if (Entry* entry = FindEntry(delta_, word, record)) {
+                delta_.erase(delta_.begin() + (entry - delta_.data()));
+                found = true;
+            } else if (Entry* entry = FindEntry(entries_, word, record)) {
+                entry->record = nullptr;
+                ++removed_;
+                found = true;
+            }
+        }
+        if (!found) return false;
+        garbage_ += key.size();
+        if (removed_ > DeltaLimit()) Merge();
+        return true;
+    }
+
+    // До limit записей, у которых ключ (или слово ключа) начинается с query; по алфавиту
+    void Prefix(std::string_view query, size_t limit, std::vector<SearchHit<Record>>& out) const {
+        out.clear();
+        std::string folded = Fold(query);
+        auto inRange = [&](auto it, const std::vector<Entry>& entries) {
+            return it != entries.end() && Key(*it).substr(0, folded.size()) == folded;
+        };
+        auto main = LowerBound(entries_, folded), delta = LowerBound(delta_, folded);
+        while (out.size() < limit) {
+            bool inMain = inRange(main, entries_), inDelta = inRange(delta, delta_);
+            if (!inMain && !inDelta) break;
+            const Entry& entry = inDelta && (!inMain || Less(*delta, *main)) ? *delta++ : *main++;
+            if (entry.record && !Contains(out, entry.record)) out.push_back({entry.record, 0});
+        }
+    }
+
+    // До limit записей с расстоянием до префикса не больше maxDistance: по возрастанию
+    // расстояния, при равном — по алфавиту. Запрос длиннее kMaxFuzzyQuery обрезается
+    void Fuzzy(std::string_view query, size_t maxDistance, size_t limit, std::vector<SearchHit<Record>>& out) const {
+        out.clear();
+        size_t m = std::min(query.size(), kMaxFuzzyQuery);
+        if (m == 0) {
+            Prefix(query, limit, out);
+            return;
+        }
+        size_t k = std::min(maxDistance, kMaxFuzzyDistance);
+        uint64_t peq[256] = {};
+        for (size_t i = 0; i < m; ++i) peq[static_cast<unsigned char>(FoldChar(query[i]))] |= 1ull << i;
+
+        // Корзины по расстоянию, отдельно для основного массива и буфера: до limit записей в каждой
+        std::vector<const Entry*> buckets[2][kMaxFuzzyDistance + 1];
+        const std::vector<Entry>* sources[2] = {&entries_, &delta_};
+        for (size_t s = 0; s < 2; ++s) {
+            const std::vector<Entry>& entries = *sources[s];
+            FuzzyWalk(entries, peq, m, k, [&](size_t begin, size_t end, uint32_t distance) {
+                auto& bucket = buckets[s][distance];
+                for (size_t e = begin; e < end && bucket.size() < limit; ++e) {
+                    if (entries[e].record && !Contains(bucket, entries[e].record)) bucket.push_back(&entries[e]);
+                }
+            });
+        }
+
+        // Запись могла попасть в несколько корзин (по разным словам) — берется лучшая
+        for (size_t d = 0; d <= k; ++d) {
+            auto main = buckets[0][d].begin(), delta = buckets[1][d].begin();
+            while (main != buckets[0][d].end() || delta != buckets[1][d].end()) {
+                if (out.size() == limit) return;
+                bool takeDelta = delta != buckets[1][d].end() && (main == buckets[0][d].end() || Less(**delta, **main));
+                const Entry* entry = takeDelta ? *delta++ : *main++;
+                if (!Contains(out, entry->record)) out.push_back({entry->record, static_cast<uint32_t>(d)});
+            }
+        }
+    }
+
+    size_t EntryCount() const { return entries_.size() - removed_ + delta_.size(); }
+    size_t GetPending() const { return delta_.size(); }
+    size_t MemoryBytes() const { return text_.capacity() + (entries_.capacity() + delta_.capacity()) * sizeof(Entry); }
+};
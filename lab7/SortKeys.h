@@ -0,0 +1,89 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+// --- Сортировка по кэшированным ключам (преобразование Шварца) ---
+// Из каждой записи один раз извлекается компактный ключ: 16 байт строки,
+// упакованные в два uint64_t так, что сравнение чисел совпадает с побайтовым
+// сравнением строк, плюс длина и исходный индекс (24 байта). Сортируется
+// непрерывный массив ключей, без обращения к записям. Группы с равным
+// префиксом досортировываются по следующим 16 байтам (к записям обращаемся
+// только для них), пока строки в группе не кончатся. Имена и телефоны обычно
+// короче 16 байт, и досортировка не нужна. Записи переставляются один раз.
+// Порядок совпадает с operator< для std::string; равные строки сохраняют
+// исходный порядок (сортировка устойчива).
+
+struct SortKey {
+    uint64_t high;   // Байты [offset, offset + 8) в порядке big-endian, недостающие — нули
+    uint64_t low;    // Байты [offset + 8, offset + 16)
+    uint32_t length; // Длина строки
+    uint32_t index;  // Позиция записи до сортировки
+
+    bool SamePrefix(const SortKey& other) const { return high == other.high && low == other.low; }
+};
+
+inline constexpr size_t kSortKeyPrefix = 16;
+
+inline uint64_t LoadKeyChunk(std::string_view text, size_t offset) {
+    size_t count = text.size() > offset ? std::min<size_t>(8, text.size() - offset) : 0;
+    if (count == 8) {
+        uint64_t chunk;
+        std::memcpy(&chunk, text.data() + offset, 8);
+        return __builtin_bswap64(chunk); // little-endian -> порядок байт строки
+    }
+    uint64_t chunk = 0;
+    for (size_t i = 0; i < 8; ++i) chunk = (chunk << 8) | (i < count ? static_cast<unsigned char>(text[offset + i]) : 0u);
+    return chunk;
+}
+
+// При равных префиксах: короче — значит меньше (строка кончилась раньше),
+// затем исходный индекс. Для групп, которые будут досортированы, это не важно
+inline bool operator<(const SortKey& a, const SortKey& b) {
+    if (a.high != b.high) return a.high < b.high;
+    if (a.low != b.low) return a.low < b.low;
+    if (a.length != b.length) return a.length < b.length;
+    return a.index < b.index;
+}
+
+template <typename Record, typename KeyOf>
+void RefineKeyRuns(const std::vector<Record*>& records, KeyOf& keyOf, SortKey* begin, SortKey* end, size_t offset) {
+    for (SortKey* run = begin; run != end;) {
+        SortKey* runEnd = run + 1;
+        size_t next = offset + kSortKeyPrefix;
+        bool longer = run->length > next;
+        while (runEnd != end && runEnd->SamePrefix(*run)) {
+            longer |= runEnd->length > next;
+            ++runEnd;
+        }
+        // Группа равных префиксов, в которой хотя бы одна строка продолжается
+        if (runEnd - run > 1 && longer) {
+            for (SortKey* key = run; key != runEnd; ++key) {
+                std::string_view text = keyOf(records[key->index]);
+                key->high = LoadKeyChunk(text, next);
+                key->low = LoadKeyChunk(text, next + 8);
+            }
+            std::sort(run, runEnd);
+            RefineKeyRuns(records, keyOf, run, runEnd, next);
+        }
+        run = runEnd;
+    }
+}
+
+template <typename Record, typename KeyOf>
+void SortByCachedKeys(std::vector<Record*>& records, KeyOf keyOf) {
+    std::vector<SortKey> keys(records.size());
+    for (size_t i = 0; i < records.size(); ++i) {
+        std::string_view key = keyOf(records[i]);
+        keys[i] = {LoadKeyChunk(key, 0), LoadKeyChunk(key, 8), static_cast<uint32_t>(key.size()), static_cast<uint32_t>(i)};
+    }
+    std::sort(keys.begin(), keys.end());
+    RefineKeyRuns(records, keyOf, keys.data(), keys.data() + keys.size(), 0);
+
+    // Единственная перестановка записей
+    std::vector<Record*> sorted(records.size());
+    for (size_t i = 0; i < keys.size(); ++i) sorted[i] = records[keys[i].index];
+    records.swap(sorted);
+}
@@ -0,0 +1,95 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// --- Поддерживаемый отсортированный порядок ---
+// Полный порядок строится стратегией один раз. Новые записи попадают в
+// небольшой отсортированный буфер (delta), который сливается с основным
+// массивом, когда вырастает до ~sqrt(n): вставка стоит O(sqrt(n)) амортизированно
+// вместо полной пересортировки. Равные записи идут в порядке добавления, поэтому
+// результат совпадает с устойчивой пересортировкой тех же записей.
+// Strategy должна предоставлять Sort(std::vector<Record*>&) и Less(a, b)
+// (в справочнике — IIncrementalSortStrategy).
+
+template <typename Record, typename Strategy>
+class SortedView {
+private:
+    const Strategy* strategy_;
+    std::vector<Record*> sorted_;
+    std::vector<Record*> delta_; // Отсортирован; записи новее всех в sorted_
+    size_t merges_ = 0;
+
+    bool Less(const Record* a, const Record* b) const { return strategy_->Less(a, b); }
+
+    size_t DeltaLimit() const {
+        return std::max<size_t>(64, static_cast<size_t>(std::sqrt(static_cast<double>(sorted_.size()))));
+    }
+
+    static bool EraseFrom(std::vector<Record*>& records, const Record* record, const SortedView& view) {
+        auto range = std::equal_range(records.begin(), records.end(), const_cast<Record*>(record),
+                                      [&](const Record* a, const Record* b) { return view.Less(a, b); });
+        auto found = std::find(range.first, range.second, record);
+        if (found == range.second) return false;
+        records.erase(found);
+        return true;
+    }
+
+public:
+    SortedView(const Strategy* strategy, const std::vector<Record*>& records) : strategy_(strategy), sorted_(records) {
+        strategy_->Sort(sorted_);
+    }
+
+    const Strategy* GetStrategy() const { return strategy_; }
+
+    void Insert(Record* record) {
+        // После равных: более новая запись идет позже
+        delta_.insert(std::upper_bound(delta_.begin(), delta_.end(), record,
+                                       [&](const Record* a, const Record* b) { return Less(a, b); }),
+                      record);
+        if (delta_.size() > DeltaLimit()) Merge();
+    }
+
+    bool Remove(const Record* record) { return EraseFrom(delta_, record, *this) || EraseFrom(sorted_, record, *this); }
+
+    // Слияние буфера с основным массивом; при равенстве основной массив первым
+    void Merge() {
+        if (delta_.empty()) return;
+        std::vector<Record*> merged(sorted_.size() + delta_.size());
+        std::merge(sorted_.begin(), sorted_.end(), delta_.begin(), delta_.end(), merged.begin(),
+                   [&](const Record* a, const Record* b) { return Less(a, b); });
+        sorted_.swap(merged);
+        delta_.clear();
+        ++merges_;
+    }
+
+    // Полный порядок как массив (буфер сливается)
+    const std::vector<Record*>& Records() {
+        Merge();
+        return sorted_;
+    }
+
+    // Обход в порядке сортировки без слияния буфера
+    template <typename Func>
+    void ForEach(Func&& func) const {
+        size_t i = 0, j = 0;
+        while (i < sorted_.size() || j < delta_.size()) {
+            bool takeDelta = j < delta_.size() && (i == sorted_.size() || Less(delta_[j], sorted_[i]));
+            func(takeDelta ? delta_[j++] : sorted_[i++]);
+        }
+    }
+
+    // Первые count записей порядка, O(count)
+    void Front(size_t count, std::vector<Record*>& out) const {
+        out.clear();
+        size_t i = 0, j = 0;
+        while (out.size() < count && (i < sorted_.size() || j < delta_.size())) {
+            bool takeDelta = j < delta_.size() && (i == sorted_.size() || Less(delta_[j], sorted_[i]));
+            out.push_back(takeDelta ? delta_[j++] : sorted_[i++]);
+        }
+    }
+
+    size_t Size() const { return sorted_.size() + delta_.size(); }
+    size_t GetPending() const { return delta_.size(); }
+    size_t GetMerges() const { return merges_; }
+};
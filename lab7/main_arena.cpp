@@ -0,0 +1,94 @@
+#include "Directory.h"
+#include "BenchUtil.h"
+#include <cstdio>
+#include <cstdlib>
+#include <malloc.h>
+#include <random>
+
+// Занятая куча (включая крупные блоки через mmap)
+size_t HeapBytes() {
+    struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+}
+
+const char* kCities[] = {"Moscow", "St. Petersburg", "Kazan", "Novosibirsk", "Yekaterinburg", "Samara", "Omsk", "Ufa"};
+const char* kStreets[] = {"Tverskaya", "Nevsky", "Baumana", "Arbat", "Lenina", "Mira", "Sadovaya", "Gagarina",
+                          "Pushkina", "Kirova", "Sovetskaya", "Molodezhnaya", "Shkolnaya", "Zelenaya", "Polevaya", "Lesnaya"};
+const char* kLegalForms[] = {"LLC", "JSC", "PJSC", "Sole proprietor"};
+
+// Каждый пятый — юр. лицо; адрес — один из 8 * 16 * 50 домов
+struct ContactSource {
+    std::mt19937_64 rng{23};
+
+    template <typename Add>
+    void Next(size_t i, Add&& add) {
+        std::string name = RandomName(rng);
+        std::string phone = RandomPhone(rng);
+        std::string address = std::string(kCities[rng() % 8]) + ", " + kStreets[rng() % 16] + " st., " +
+                              std::to_string(1 + rng() % 50);
+        if (i % 5 == 0) add(true, name, phone, address, kLegalForms[rng() % 4]);
+        else add(false, name, phone, address, "user" + std::to_string(i) + "@mail.ru");
+    }
+};
+
+// Параметры: [число контактов]
+int main(int argc, char* argv[]) {
+    std::cout << "--- LR7: Arena Storage ---" << std::endl;
+
+    // 1. Сценарий main_strategy в режиме арены; одинаковые адреса хранятся один раз
+    {
+        Directory directory("Company Contacts", "Sidorov A.V.", ContactStorage::Arena);
+        Contact* ivanov = directory.AddPhysicalContact("Ivanov P.I.", "8-901-123-4567", "Moscow, Tverskaya", "ivanov@mail.ru");
+        directory.AddLegalContact("Alpha LLC", "8-800-200-0000", "St. Petersburg, Nevsky", "LLC");
+        Contact* zuev = directory.AddPhysicalContact("Zuev A.A.", "8-903-987-6543", "Moscow, Tverskaya", "zuev@corp.com");
+        directory.AddContact(new LegalContact("Beta JSC", "8-495-111-2233", "Moscow, Arbat", "JSC")); // Владеет справочник
+        SortByNameStrategy byName;
+        directory.SetSortStrategy(&byName);
+        directory.SortRecords();
+        directory.DisplayRecords();
+        bool shared = ivanov->GetAddress().data() == zuev->GetAddress().data();
+        directory.RemoveContact(zuev);
+        std::cout << "[Arena] Same address stored once: " << (shared ? "yes" : "no")
+                  << ", interned strings: " << directory.GetInternedStrings() << ", arena: " << directory.GetArena().BytesUsed()
+                  << " bytes in " << directory.GetArena().BlockCount() << " block(s)" << std::endl;
+    }
+
+    size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000000;
+    std::cout << "\n--- Benchmark (" << count << " contacts, 1 in 5 legal) ---" << std::endl;
+
+    for (ContactStorage storage : {ContactStorage::Heap, ContactStorage::Arena}) {
+        bool arena = storage == ContactStorage::Arena;
+        size_t heapBefore = HeapBytes();
+        std::cout.setstate(std::ios::badbit);
+        auto directory = std::make_unique<Directory>("Bench", "Bench", storage);
+        directory->Reserve(count);
+        size_t indexBytes = HeapBytes() - heapBefore; // Массив записей и хеш-индексы одинаковы в обоих режимах
+        ContactSource source;
+        double buildTime = Seconds([&] {
+            for (size_t i = 0; i < count; ++i) {
+                source.Next(i, [&](bool legal, const std::string& name, const std::string& phone, const std::string& address,
+                                   const std::string& extra) {
+                    if (arena) {
+                        if (legal) directory->AddLegalContact(name, phone, address, extra);
+                        else directory->AddPhysicalContact(name, phone, address, extra);
+                    } else if (legal) {
+                        directory->AddContact(new LegalContact(name, phone, address, extra));
+                    } else {
+                        directory->AddContact(new PhysicalContact(name, phone, address, extra));
+                    }
+                });
+            }
+        });
+        size_t contactBytes = HeapBytes() - heapBefore - indexBytes;
+        std::string arenaInfo = arena ? ", arena used: " + std::to_string(directory->GetArena().BytesUsed() / count) +
+                                            " bytes/contact in " + std::to_string(directory->GetArena().BlockCount()) +
+                                            " blocks, interned strings: " + std::to_string(directory->GetInternedStrings())
+                                      : "";
+        double destroyTime = Seconds([&] { directory.reset(); });
+        std::cout.clear();
+        std::cout << "[" << (arena ? "Arena" : "Heap") << "] Build: " << buildTime << " s, destroy: " << destroyTime
+                  << " s, contacts: " << double(contactBytes) / count << " bytes/contact (+ "
+                  << double(indexBytes) / count << " for records and indexes)" << arenaInfo << std::endl;
+    }
+    return 0;
+}
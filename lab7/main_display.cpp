@@ -0,0 +1,98 @@
+#include "Directory.h"
+#define BENCH_COUNT_ALLOCATIONS // Счетчик выделений: см. BenchUtil.h
+#include "BenchUtil.h"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+const char* kLegalForms[] = {"LLC", "JSC", "PJSC"};
+
+// Прежний вывод: цепочки operator+ и std::endl на каждую запись
+std::string LegacyToString(const Contact* c) {
+    std::string text = "Name: " + std::string(c->GetName()) + ", Phone: " + std::string(c->GetPhone()) +
+                       ", Address: " + std::string(c->GetAddress());
+    if (auto legal = dynamic_cast<const LegalContact*>(c)) return text + ", Type: Legal (" + std::string(legal->GetLegalForm()) + ")";
+    if (auto physical = dynamic_cast<const PhysicalContact*>(c)) return text + ", Type: Physical, Email: " + std::string(physical->GetEmail());
+    return text;
+}
+
+// Параметры: [число контактов] [файл для вывода]
+int main(int argc, char* argv[]) {
+    std::cout << "--- LR7: Buffered Display ---" << std::endl;
+
+    // 1. Сценарий: прежний вывод и вывод через буфер совпадают побайтно
+    {
+        Directory directory("Company Contacts", "Sidorov A.V.");
+        directory.AddContact(new PhysicalContact("Ivanov P.I.", "8-901-123-4567", "Moscow, Tverskaya", "ivanov@mail.ru"));
+        directory.AddContact(new LegalContact("Alpha LLC", "8-800-200-0000", "St. Petersburg, Nevsky", "LLC"));
+        directory.AddContact(new Contact("Zuev A.A.", "8-903-987-6543", "Kazan, Baumana"));
+        directory.DisplayRecords();
+        std::cout << "[Display] ToString: " << directory.FindByName("Alpha LLC")->ToString() << std::endl;
+    }
+
+    size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    std::string path = argc > 2 ? argv[2] : "directory_listing.txt";
+
+    std::mt19937_64 rng(29);
+    std::cout.setstate(std::ios::badbit);
+    Directory directory("Bench", "Bench");
+    directory.Reserve(count);
+    std::vector<Contact*> contacts;
+    contacts.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        std::string name = RandomName(rng);
+        std::string phone = RandomPhone(rng);
+        std::string address = "Moscow, Tverskaya st., " + std::to_string(1 + rng() % 200);
+        Contact* c = i % 5 == 0 ? static_cast<Contact*>(new LegalContact(name, phone, address, kLegalForms[rng() % 3]))
+                                : new PhysicalContact(name, phone, address, "user" + std::to_string(i) + "@mail.ru");
+        directory.AddContact(c);
+        contacts.push_back(c);
+    }
+    std::cout.clear();
+    std::cout << "\n--- Benchmark (" << count << " contacts, output to " << path << ") ---" << std::endl;
+
+    auto fileSize = [&] {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        return static_cast<double>(in.tellg());
+    };
+    auto readFile = [&] {
+        std::ifstream in(path, std::ios::binary);
+        std::stringstream text;
+        text << in.rdbuf();
+        return text.str();
+    };
+    auto report = [&](const char* label, double time, uint64_t allocations) {
+        double megabytes = fileSize() / (1024 * 1024);
+        std::cout << "[" << label << "] " << time << " s, " << megabytes / time << " MB/s, " << count / time
+                  << " records/s, allocations/record: " << double(allocations) / count << std::endl;
+    };
+
+    // Прежний способ: ToString с временными строками и std::endl (сброс потока) на запись
+    uint64_t allocations = g_allocations.load();
+    double legacyTime = Seconds([&] {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << "\n=== Directory: Bench (Owner: Bench) ===" << std::endl;
+        size_t i = 0;
+        for (const Contact* c : contacts) out << "[" << ++i << "] " << LegacyToString(c) << std::endl;
+        out << "---------------------------------------" << std::endl;
+    });
+    report("Legacy ToString + endl", legacyTime, g_allocations.load() - allocations);
+    std::string legacyListing = readFile();
+
+    // Буфер справочника выделяется при первом выводе и далее переиспользуется
+    for (int run = 0; run < 2; ++run) {
+        allocations = g_allocations.load();
+        double time = Seconds([&] {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            directory.DisplayRecords(out);
+        });
+        report(run == 0 ? "DisplayRecords, first run" : "DisplayRecords, warm buffer", time,
+               g_allocations.load() - allocations);
+    }
+    std::cout << "[Display] Output identical to legacy: " << (readFile() == legacyListing ? "yes" : "no") << std::endl;
+    std::remove(path.c_str());
+    std::cout.setstate(std::ios::badbit);
+    return 0;
+}
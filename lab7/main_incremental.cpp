@@ -0,0 +1,147 @@
+#include "Directory.h"
+#include "BenchUtil.h"
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+
+// Стратегия из другого модуля: только ISortStrategy, без сравнения пары записей
+class ReverseNameStrategy : public ISortStrategy {
+public:
+    std::string GetName() const override { return "by Name, descending"; }
+    void Sort(std::vector<Contact*>& records) const override {
+        std::stable_sort(records.begin(), records.end(),
+                         [](const Contact* a, const Contact* b) { return a->GetName() > b->GetName(); });
+    }
+};
+
+struct Workload {
+    const char* label;
+    size_t insertsPerRead;
+    bool fullScan; // Чтение всего порядка, иначе — первая страница (20 записей)
+};
+
+// Параметры: [размер справочника] [число циклов «вставки + чтение»]
+int main(int argc, char* argv[]) {
+    std::cout << "--- LR7: Incremental Sorted Views ---" << std::endl;
+
+    // 1. Сценарий: порядок поддерживается при добавлении, смена стратегии не пересортировывает
+    {
+        CachedSortByNameStrategy byName;
+        CachedSortByPhoneStrategy byPhone;
+        Directory directory("Company Contacts", "Sidorov A.V.");
+        directory.SetIncrementalSort(true);
+        directory.AddContact(new PhysicalContact("Ivanov P.I.", "8-901-123-4567", "Moscow, Tverskaya", "ivanov@mail.ru"));
+        directory.AddContact(new LegalContact("Alpha LLC", "8-800-200-0000", "St. Petersburg, Nevsky", "LLC"));
+        directory.SetSortStrategy(&byName);
+        directory.SortRecords();
+        directory.SetSortStrategy(&byPhone);
+        directory.SortRecords();
+        directory.AddContact(new PhysicalContact("Zuev A.A.", "8-903-987-6543", "Kazan, Baumana", "zuev@corp.com"));
+        directory.AddContact(new LegalContact("Beta JSC", "8-495-111-2233", "Moscow, Arbat", "JSC"));
+        directory.DisplayRecords();
+        directory.SetSortStrategy(&byName);
+        directory.SortRecords();
+        directory.DisplayRecords();
+        // Такой порядок не поддерживается представлением: массив сортируется целиком
+        ReverseNameStrategy descending;
+        directory.SetSortStrategy(&descending);
+        directory.SortRecords();
+        directory.DisplayRecords();
+    }
+
+    // Простые стратегии тоже устойчивы: при повторяющихся именах поддерживаемый
+    // порядок совпадает с полной пересортировкой
+    {
+        SortByNameStrategy byName;
+        SortByPhoneStrategy byPhone;
+        std::mt19937_64 rng(9);
+        std::cout.setstate(std::ios::badbit);
+        Directory directory("Repeated names", "Check");
+        directory.SetIncrementalSort(true);
+        for (size_t i = 0; i < 5000; ++i) directory.AddContact(RandomContact(rng));
+        SortedContactView& nameView = directory.GetSortedView(&byName);
+        SortedContactView& phoneView = directory.GetSortedView(&byPhone);
+        for (size_t i = 0; i < 20000; ++i) directory.AddContact(RandomContact(rng));
+        std::vector<Contact*> maintainedName = nameView.Records(), maintainedPhone = phoneView.Records();
+        directory.SetIncrementalSort(false);
+        directory.SetIncrementalSort(true);
+        bool same = maintainedName == directory.GetSortedView(&byName).Records() &&
+                    maintainedPhone == directory.GetSortedView(&byPhone).Records();
+        std::cout.clear();
+        std::cout << "\n[Check] " << byName.GetName() << " / " << byPhone.GetName()
+                  << ", 25000 contacts with repeated names: maintained order matches re-sort: " << (same ? "yes" : "no")
+                  << std::endl;
+    }
+
+    size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    size_t rounds = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 200;
+    const Workload workloads[] = {{"1 insert + first page", 1, false},
+                                  {"100 inserts + first page", 100, false},
+                                  {"1000 inserts + full scan", 1000, true}};
+
+    CachedSortByNameStrategy byName;
+    CachedSortByPhoneStrategy byPhone;
+    std::cout << "\n--- Benchmark (" << count << " contacts, name and phone orders maintained) ---" << std::endl;
+    for (const Workload& w : workloads) {
+        std::mt19937_64 rng(5);
+        std::cout.setstate(std::ios::badbit);
+        Directory full("Full re-sort", "Bench"), incremental("Incremental", "Bench");
+        incremental.SetIncrementalSort(true);
+        for (size_t i = 0; i < count; ++i) {
+            Contact* c = RandomContact(rng);
+            full.AddContact(c);
+            incremental.AddContact(new Contact(*c));
+        }
+        SortedContactView& nameView = incremental.GetSortedView(&byName);
+        SortedContactView& phoneView = incremental.GetSortedView(&byPhone);
+        uint64_t checksum = 0;
+        std::vector<Contact*> page;
+        ISortStrategy* strategies[] = {&byName, &byPhone};
+
+        // Прежний способ: после вставок — SortRecords() по имени и по телефону
+        size_t fullRounds = std::max<size_t>(1, std::min<size_t>(rounds, 5));
+        double fullTime = Seconds([&] {
+            for (size_t r = 0; r < fullRounds; ++r) {
+                for (size_t k = 0; k < w.insertsPerRead; ++k) full.AddContact(RandomContact(rng));
+                for (ISortStrategy* strategy : strategies) {
+                    full.SetSortStrategy(strategy);
+                    full.SortRecords();
+                }
+            }
+        });
+        // Инкрементально: вставки сливаются в оба представления, чтение — обход или первая страница
+        double incrementalTime = Seconds([&] {
+            for (size_t r = 0; r < rounds; ++r) {
+                for (size_t k = 0; k < w.insertsPerRead; ++k) incremental.AddContact(RandomContact(rng));
+                for (SortedContactView* view : {&nameView, &phoneView}) {
+                    if (w.fullScan) {
+                        view->ForEach([&](const Contact* c) { checksum += c->GetName().size(); });
+                    } else {
+                        view->Front(20, page);
+                        checksum += page.size();
+                    }
+                }
+            }
+        });
+
+        // Проверка: поддерживаемые порядки совпадают с устойчивой пересортировкой
+        std::vector<Contact*> expectedName = nameView.Records(), checkName;
+        std::vector<Contact*> expectedPhone = phoneView.Records(), checkPhone;
+        size_t merges = nameView.GetMerges();
+        incremental.SetIncrementalSort(false);
+        incremental.SetIncrementalSort(true);
+        checkName = incremental.GetSortedView(&byName).Records();
+        checkPhone = incremental.GetSortedView(&byPhone).Records();
+        std::cout.clear();
+
+        double fullPerRound = fullTime / fullRounds, incrementalPerRound = incrementalTime / rounds;
+        std::cout << "[" << w.label << "] Full re-sort: " << fullPerRound * 1e3 << " ms/round, incremental: "
+                  << incrementalPerRound * 1e3 << " ms/round (" << fullPerRound / incrementalPerRound
+                  << "x), merges: " << merges << ", matches re-sort: "
+                  << (expectedName == checkName && expectedPhone == checkPhone ? "yes" : "no") << std::endl;
+        std::cout.setstate(std::ios::badbit);
+    }
+    std::cout.clear();
+    return 0;
+}
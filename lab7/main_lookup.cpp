@@ -0,0 +1,144 @@
+#include "Directory.h"
+#define BENCH_COUNT_ALLOCATIONS // Счетчик выделений: см. BenchUtil.h
+#include "BenchUtil.h"
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+
+std::string MakeName(size_t i) {
+    return std::string(kSurnames[i % 16]) + " " + char('A' + i / 16 % 26) + "." + char('A' + i / 416 % 26) + ". #" +
+           std::to_string(i);
+}
+
+// Телефон в справочнике: 8-9XX-XXX-XXXX
+std::string MakePhone(size_t i) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "8-9%02zu-%03zu-%04zu", i / 10000000 % 100, i / 10000 % 1000, i % 10000);
+    return buffer;
+}
+
+// Тот же телефон в другом написании: +7 (9XX) XXX-XX-XX
+std::string MakeQueryPhone(size_t i) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "+7 (9%02zu) %03zu-%02zu-%02zu", i / 10000000 % 100, i / 10000 % 1000,
+                  i % 10000 / 100, i % 100);
+    return buffer;
+}
+
+// Параметры: [число контактов] [число запросов]
+int main(int argc, char* argv[]) {
+    std::cout << "--- LR7: Hash-Indexed Contact Lookup ---" << std::endl;
+
+    // 1. Поиск на примере из main_strategy
+    {
+        Directory directory("Company Contacts", "Sidorov A.V.");
+        directory.AddContact(new PhysicalContact("Ivanov P.I.", "8-901-123-4567", "Moscow, Tverskaya", "ivanov@mail.ru"));
+        directory.AddContact(new LegalContact("Alpha LLC", "8-800-200-0000", "St. Petersburg, Nevsky", "LLC"));
+        directory.AddContact(new PhysicalContact("Zuev A.A.", "8-903-987-6543", "Kazan, Baumana", "zuev@corp.com"));
+
+        Contact* byPhone = directory.FindByPhone("+7 (903) 987-65-43");
+        std::cout << "\n[Lookup] Phone +7 (903) 987-65-43: " << (byPhone ? byPhone->ToString() : "not found") << std::endl;
+        Contact* byName = directory.FindByName("Alpha LLC");
+        std::cout << "[Lookup] Name Alpha LLC: " << (byName ? byName->ToString() : "not found") << std::endl;
+        directory.RemoveContact(byName);
+        std::cout << "[Lookup] After removal: " << (directory.FindByName("Alpha LLC") ? "found" : "not found")
+                  << ", by phone 88002000000: " << (directory.FindByPhone("88002000000") ? "found" : "not found")
+                  << std::endl;
+    }
+
+    size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    size_t queries = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 1000000;
+
+    // 2. Загрузка справочника
+    std::cout.setstate(std::ios::badbit);
+    Directory directory("Benchmark", "Load Test");
+    directory.Reserve(count);
+    std::vector<Contact*> contacts;
+    contacts.reserve(count);
+    double load = Seconds([&] {
+        for (size_t i = 0; i < count; ++i) {
+            contacts.push_back(new PhysicalContact(MakeName(i), MakePhone(i), "Moscow", "user@mail.ru"));
+            directory.AddContact(contacts.back());
+        }
+    });
+    std::cout.clear();
+
+    // Запросы: 90% попаданий, телефон — в другом написании
+    std::mt19937_64 rng(42);
+    std::vector<std::string> names(queries), phones(queries);
+    for (size_t q = 0; q < queries; ++q) {
+        size_t i = rng() % (count + count / 9);
+        names[q] = i < count ? MakeName(i) : "Nobody #" + std::to_string(i);
+        phones[q] = MakeQueryPhone(i < count ? i : i + 90000000);
+    }
+
+    // 3. Индексы
+    size_t nameHits = 0, phoneHits = 0;
+    uint64_t allocationsBefore = g_allocations.load();
+    double nameLookup = Seconds([&] {
+        for (const std::string& name : names) nameHits += directory.FindByName(name) != nullptr;
+    });
+    double phoneLookup = Seconds([&] {
+        for (const std::string& phone : phones) phoneHits += directory.FindByPhone(phone) != nullptr;
+    });
+    uint64_t lookupAllocations = g_allocations.load() - allocationsBefore;
+
+    // 4. Линейный просмотр (прежний способ): на части запросов
+    size_t scanQueries = std::min<size_t>(queries, std::max<size_t>(1, 20000000 / count));
+    size_t scanNameHits = 0, scanPhoneHits = 0;
+    double nameScan = Seconds([&] {
+        for (size_t q = 0; q < scanQueries; ++q) {
+            scanNameHits += std::find_if(contacts.begin(), contacts.end(),
+                                         [&](const Contact* c) { return c->GetName() == names[q]; }) != contacts.end();
+        }
+    });
+    double phoneScan = Seconds([&] {
+        for (size_t q = 0; q < scanQueries; ++q) {
+            std::string key = NormalizePhone(phones[q]);
+            scanPhoneHits += std::find_if(contacts.begin(), contacts.end(),
+                                          [&](const Contact* c) { return c->GetPhoneKey() == key; }) != contacts.end();
+        }
+    });
+    size_t indexedNameHits = 0;
+    for (size_t q = 0; q < scanQueries; ++q) indexedNameHits += directory.FindByName(names[q]) != nullptr;
+
+    // 5. Удаление: индексы остаются согласованными
+    std::cout.setstate(std::ios::badbit);
+    size_t removals = std::min<size_t>(1000, count / 2);
+    std::vector<Contact*> victims;
+    for (size_t r = 0; r < removals; ++r) victims.push_back(contacts[(r * 7919) % count]);
+    std::sort(victims.begin(), victims.end());
+    victims.erase(std::unique(victims.begin(), victims.end()), victims.end());
+    std::vector<std::string> removedNames, removedPhones;
+    for (Contact* c : victims) {
+        removedNames.emplace_back(c->GetName());
+        removedPhones.emplace_back(c->GetPhone());
+    }
+    double remove = Seconds([&] {
+        for (Contact* c : victims) directory.RemoveContact(c);
+    });
+    std::cout.clear();
+    size_t stale = 0;
+    for (size_t r = 0; r < victims.size(); ++r) {
+        stale += directory.FindByName(removedNames[r]) != nullptr;
+        stale += directory.FindByPhone(removedPhones[r]) != nullptr;
+    }
+
+    std::cout << "\n--- Benchmark (" << count << " contacts, " << queries << " queries) ---" << std::endl;
+    std::cout << "[Load] " << count / load / 1e6 << " M contacts/s" << std::endl;
+    std::cout << "[Index] Name: " << nameLookup / queries * 1e9 << " ns/lookup (" << nameHits << " hits), phone: "
+              << phoneLookup / queries * 1e9 << " ns/lookup (" << phoneHits << " hits), allocations: "
+              << lookupAllocations << std::endl;
+    std::cout << "[Scan] Name: " << nameScan / scanQueries * 1e9 << " ns/lookup, phone: "
+              << phoneScan / scanQueries * 1e9 << " ns/lookup (" << scanQueries << " queries, hits "
+              << scanNameHits << "/" << scanPhoneHits << ", index agrees: "
+              << (scanNameHits == indexedNameHits ? "yes" : "no") << ")" << std::endl;
+    std::cout << "[Speedup] Name: " << (nameScan / scanQueries) / (nameLookup / queries) << "x, phone: "
+              << (phoneScan / scanQueries) / (phoneLookup / queries) << "x" << std::endl;
+    std::cout << "[Remove] " << victims.size() << " contacts: " << remove / victims.size() * 1e6
+              << " us/remove, stale index hits: " << stale << ", size " << directory.Size() << std::endl;
+
+    std::cout.setstate(std::ios::badbit); // Деструктор справочника
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include "Directory.h"
+#include "BenchUtil.h"
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+
+// Параметры: [число контактов] [максимум потоков]
+int main(int argc, char* argv[]) {
+    std::cout << "--- LR7: Parallel and Radix Sort Strategies ---" << std::endl;
+
+    size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000000;
+    size_t maxThreads = argc > 2 ? std::strtoul(argv[2], nullptr, 10)
+                                 : std::max<size_t>(4, std::thread::hardware_concurrency());
+
+    // 1. Новые стратегии в сценарии main_strategy
+    {
+        ThreadPool pool(2);
+        ParallelSortByNameStrategy byName(&pool);
+        RadixSortByPhoneStrategy byPhone(&pool);
+        Directory directory("Company Contacts", "Sidorov A.V.");
+        directory.AddContact(new PhysicalContact("Ivanov P.I.", "8-901-123-4567", "Moscow, Tverskaya", "ivanov@mail.ru"));
+        directory.AddContact(new LegalContact("Alpha LLC", "8-800-200-0000", "St. Petersburg, Nevsky", "LLC"));
+        directory.AddContact(new PhysicalContact("Zuev A.A.", "8-903-987-6543", "Kazan, Baumana", "zuev@corp.com"));
+        directory.AddContact(new PhysicalContact("Ivanov P.I.", "+7 (800) 200-00-00", "Moscow, Arbat", "ivanov2@mail.ru"));
+        directory.SetSortStrategy(&byName);
+        directory.SortRecords();
+        directory.DisplayRecords();
+        directory.SetSortStrategy(&byPhone);
+        directory.SortRecords();
+        directory.DisplayRecords();
+    }
+
+    // Телефоны одного формата, много однофамильцев
+    std::mt19937_64 rng(11);
+    std::vector<Contact*> contacts;
+    contacts.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        std::string name = RandomName(rng);
+        std::string phone = RandomPhone(rng);
+        contacts.push_back(new Contact(name, phone, "Moscow"));
+    }
+
+    auto run = [&](const ISortStrategy& strategy, std::vector<Contact*>& out) {
+        out = contacts;
+        return Seconds([&] { strategy.Sort(out); });
+    };
+
+    // Эталоны: прежние стратегии и устойчивая сортировка по кэшированным ключам
+    std::vector<Contact*> legacyName, legacyPhone, referenceName, referencePhone;
+    double legacyNameTime = run(SortByNameStrategy(), legacyName);
+    double legacyPhoneTime = run(SortByPhoneStrategy(), legacyPhone);
+    double cachedNameTime = run(CachedSortByNameStrategy(), referenceName);
+    double cachedPhoneTime = run(CachedSortByPhoneStrategy(), referencePhone);
+    bool sameAsLegacy = true;
+    for (size_t i = 0; i < count; ++i) {
+        sameAsLegacy &= legacyName[i]->GetName() == referenceName[i]->GetName();
+        sameAsLegacy &= legacyPhone[i]->GetPhone() == referencePhone[i]->GetPhone();
+    }
+
+    std::cout << "\n--- Benchmark (" << count << " contacts, " << std::thread::hardware_concurrency()
+              << " hardware threads) ---" << std::endl;
+    std::cout << "[Sequential] std::sort by Name: " << legacyNameTime << " s, by Phone: " << legacyPhoneTime << " s" << std::endl;
+    std::cout << "[Sequential] Cached keys by Name: " << cachedNameTime << " s, by Phone: " << cachedPhoneTime
+              << " s (same order as std::sort: " << (sameAsLegacy ? "yes" : "no") << ")" << std::endl;
+
+    std::vector<Contact*> result;
+    double radixTime = run(RadixSortByPhoneStrategy(), result);
+    bool radixSame = result == referencePhone; // Один формат: совпадает с устойчивым порядком по строке
+    std::cout << "[Sequential] MSD radix by Phone digits: " << radixTime << " s (" << legacyPhoneTime / radixTime
+              << "x vs std::sort), identical to stable order: " << (radixSame ? "yes" : "no") << std::endl;
+
+    // 2. Масштабирование: результат побайтно совпадает с эталоном при любом числе потоков
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        ThreadPool pool(threads);
+        double name = run(ParallelSortByNameStrategy(&pool), result);
+        bool nameSame = result == referenceName;
+        double phone = run(ParallelSortByPhoneStrategy(&pool), result);
+        bool phoneSame = result == referencePhone;
+        double radix = run(RadixSortByPhoneStrategy(&pool), result);
+        bool radixParallelSame = result == referencePhone;
+        std::cout << "[Threads " << threads << "] Merge by Name: " << name << " s (" << legacyNameTime / name
+                  << "x), by Phone: " << phone << " s (" << legacyPhoneTime / phone << "x), radix: " << radix
+                  << " s (" << legacyPhoneTime / radix << "x); deterministic: "
+                  << (nameSame && phoneSame && radixParallelSame ? "yes" : "no") << std::endl;
+    }
+
+    for (Contact* c : contacts) delete c;
+    return 0;
+}
@@ -0,0 +1,229 @@
+#include "Directory.h"
+#include "BenchUtil.h"
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+void PrintHits(const std::string& label, const std::vector<ContactSearchHit>& hits) {
+    std::cout << "[Search] " << label << ": " << hits.size() << " found" << std::endl;
+    for (const auto& hit : hits) {
+        std::cout << "  " << hit.record->GetName() << ", " << hit.record->GetPhone() << " (distance " << hit.distance
+                  << ")" << std::endl;
+    }
+}
+
+bool SameHits(const std::vector<ContactSearchHit>& a, const std::vector<ContactSearchHit>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].record != b[i].record || a[i].distance != b[i].distance) return false;
+    }
+    return true;
+}
+
+// Эталон: классическая таблица расстояний, минимум по префиксам каждого слова имени
+uint32_t BruteForceDistance(std::string_view query, std::string_view name) {
+    uint32_t best = UINT32_MAX;
+    std::vector<uint32_t> row(query.size() + 1), next(query.size() + 1);
+    for (size_t start = 0; start < name.size(); ++start) {
+        if (start > 0 && name[start - 1] != ' ') continue;
+        for (size_t i = 0; i <= query.size(); ++i) row[i] = static_cast<uint32_t>(i);
+        best = std::min(best, row[query.size()]);
+        for (size_t j = start; j < name.size(); ++j) {
+            next[0] = static_cast<uint32_t>(j - start + 1);
+            for (size_t i = 1; i <= query.size(); ++i) {
+                uint32_t cost = FoldChar(query[i - 1]) == FoldChar(name[j]) ? 0 : 1;
+                next[i] = std::min({row[i] + 1, next[i - 1] + 1, row[i - 1] + cost});
+            }
+            row.swap(next);
+            best = std::min(best, row[query.size()]);
+        }
+    }
+    return best;
+}
+
+// Параметры: [число контактов] [число запросов]
+int main(int argc, char* argv[]) {
+    std::cout << "--- LR7: Prefix and Fuzzy Search ---" << std::endl;
+
+    // 1. Сценарий: поиск по слову имени, по телефону в любом написании, с опечатками
+    {
+        Directory directory("Company Contacts", "Sidorov A.V.");
+        directory.AddContact(new PhysicalContact("Ivanov P.I.", "8-901-123-4567", "Moscow, Tverskaya", "ivanov@mail.ru"));
+        directory.AddContact(new LegalContact("Alpha LLC", "8-800-200-0000", "St. Petersburg, Nevsky", "LLC"));
+        directory.AddContact(new PhysicalContact("Zuev A.A.", "8-903-987-6543", "Kazan, Baumana", "zuev@corp.com"));
+        directory.AddContact(new PhysicalContact("Ivanova M.S.", "+7 (901) 555-12-12", "Moscow, Arbat", "ivanova@mail.ru"));
+        PrintHits("prefix 'iva'", directory.SearchByPrefix("iva"));
+        PrintHits("prefix 'LL'", directory.SearchByPrefix("LL"));
+        PrintHits("prefix '8-901'", directory.SearchByPrefix("8-901"));
+        PrintHits("fuzzy 'Ivnaov' (<= 2)", directory.SearchFuzzy("Ivnaov", 2));
+        PrintHits("fuzzy 'Zuv' (<= 1)", directory.SearchFuzzy("Zuv", 1));
+        PrintHits("fuzzy '8-903-978' (<= 2)", directory.SearchFuzzy("8-903-978", 2));
+    }
+
+    size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    size_t queries = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 200;
+
+    std::mt19937_64 rng(17);
+    std::vector<std::string> names, phones;
+    names.reserve(count);
+    phones.reserve(count);
+    std::cout.setstate(std::ios::badbit);
+    Directory directory("Bench", "Bench");
+    directory.Reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        names.push_back(RandomName(rng, 64));
+        phones.push_back(RandomPhone(rng));
+        directory.AddContact(new Contact(names.back(), phones.back(), "Moscow"));
+    }
+    std::cout.clear();
+
+    std::cout << "\n--- Benchmark (" << count << " contacts, "
+              << "bit-parallel columns, trie walk over sorted keys" << ") ---" << std::endl;
+    size_t bytes = 0;
+    double buildTime = Seconds([&] { bytes = directory.GetSearchIndexBytes(); });
+    std::cout << "[Index] Built in " << buildTime << " s, " << double(bytes) / count << " bytes per contact" << std::endl;
+
+    // Запросы: начало фамилии или инициалов, начало телефона, фамилия с одной опечаткой
+    std::vector<std::string> namePrefixes, phonePrefixes, typos, phoneTypos;
+    for (size_t q = 0; q < queries; ++q) {
+        const std::string& name = names[rng() % count];
+        size_t word = rng() % 3 == 0 ? name.find(' ') + 1 : 0;
+        namePrefixes.push_back(name.substr(word, 1 + rng() % 6));
+        phonePrefixes.push_back(phones[rng() % count].substr(0, 3 + rng() % 7));
+        std::string typo = name.substr(0, std::min(name.find(' '), size_t(4 + rng() % 5)));
+        size_t at = rng() % typo.size();
+        switch (rng() % 3) {
+        case 0: typo[at] = char('a' + rng() % 26); break;
+        case 1: typo.erase(at, 1); break;
+        default: typo.insert(typo.begin() + at, char('a' + rng() % 26)); break;
+        }
+        typos.push_back(typo);
+        // Телефон почти целиком, одна цифра неверна: ключи различны, работает в основном ядро
+        std::string phoneTypo = phones[rng() % count].substr(0, 8 + rng() % 7);
+        char& digit = phoneTypo[phoneTypo.size() - 1 - rng() % 3];
+        if (digit >= '0' && digit <= '9') digit = char('0' + (digit - '0' + 1) % 10);
+        phoneTypos.push_back(phoneTypo);
+    }
+
+    size_t found = 0;
+    auto qps = [&](const std::vector<std::string>& batch, auto&& search) {
+        double time = Seconds([&] {
+            for (const std::string& query : batch) found += search(query);
+        });
+        return batch.size() / time;
+    };
+    double prefixQps = qps(namePrefixes, [&](const std::string& q) { return directory.SearchByPrefix(q).size(); });
+    double phoneQps = qps(phonePrefixes, [&](const std::string& q) { return directory.SearchByPrefix(q).size(); });
+    // Без индекса: просмотр всех имен
+    std::vector<std::string> scanBatch(namePrefixes.begin(), namePrefixes.begin() + std::min<size_t>(queries, 20));
+    double scanQps = qps(scanBatch, [&](const std::string& q) {
+        size_t matches = 0;
+        for (const std::string& name : names) {
+            for (size_t start = 0; start < name.size(); start = name.find(' ', start) + 1) {
+                size_t i = 0;
+                while (i < q.size() && start + i < name.size() && FoldChar(name[start + i]) == FoldChar(q[i])) ++i;
+                if (i == q.size()) {
+                    ++matches;
+                    break;
+                }
+                if (name.find(' ', start) == std::string::npos) break;
+            }
+        }
+        return matches;
+    });
+    std::cout << "[Prefix] Names: " << prefixQps << " queries/s, phones: " << phoneQps
+              << " queries/s (linear scan: " << scanQps << " queries/s)" << std::endl;
+
+    for (size_t distance = 1; distance <= 2; ++distance) {
+        double fuzzyQps = qps(typos, [&](const std::string& q) { return directory.SearchFuzzy(q, distance).size(); });
+        double phoneFuzzyQps = qps(phoneTypos, [&](const std::string& q) { return directory.SearchFuzzy(q, distance).size(); });
+        std::cout << "[Fuzzy] Distance <= " << distance << ": names " << fuzzyQps << " queries/s, phones "
+                  << phoneFuzzyQps << " queries/s" << std::endl;
+    }
+
+    // 2. Проверка нечеткого поиска по полной таблице расстояний: найденные записи и их
+    // расстояния совпадают с лучшими по перебору
+    size_t checks = std::min<size_t>(queries, 10);
+    bool correct = true;
+    double bruteTime = Seconds([&] {
+        for (size_t q = 0; q < checks; ++q) {
+            std::vector<uint32_t> expected;
+            for (const std::string& name : names) {
+                uint32_t distance = BruteForceDistance(typos[q], name);
+                if (distance <= 2) expected.push_back(distance);
+            }
+            std::sort(expected.begin(), expected.end());
+            expected.resize(std::min<size_t>(expected.size(), 10));
+            std::vector<ContactSearchHit> hits = directory.SearchFuzzy(typos[q], 2);
+            correct &= hits.size() == expected.size();
+            for (size_t i = 0; i < hits.size() && correct; ++i) {
+                correct = hits[i].distance == expected[i] &&
+                          hits[i].distance == BruteForceDistance(typos[q], hits[i].record->GetName());
+            }
+        }
+    });
+    std::cout << "[Fuzzy] Brute force: " << checks / bruteTime << " queries/s, index results match: "
+              << (correct ? "yes" : "no") << " (" << found << " hits total)" << std::endl;
+
+    // 3. Правки между нажатиями: индекс поддерживается, а не строится заново
+    std::vector<Contact*> added;
+    size_t rounds = 2000;
+    double editTime = Seconds([&] {
+        std::cout.setstate(std::ios::badbit);
+        for (size_t r = 0; r < rounds; ++r) {
+            directory.RemoveContact(directory.FindByPhone(phones[rng() % count]));
+            added.push_back(RandomContact(rng, 64));
+            directory.AddContact(added.back());
+            found += directory.SearchFuzzy(typos[r % typos.size()], 1).size();
+        }
+        std::cout.clear();
+    });
+    std::cout << "[Incremental] Remove + add + fuzzy query: " << editTime / rounds * 1e3
+              << " ms/round (full rebuild: " << buildTime * 1e3 << " ms)" << std::endl;
+
+    // Поддерживаемый индекс совпадает с построенным заново: много удалений (с
+    // уплотнением строк) и добавлений вперемешку с запросами
+    {
+        std::cout.setstate(std::ios::badbit);
+        Directory small("Churn", "Check");
+        std::vector<Contact*> live;
+        for (size_t i = 0; i < 20000; ++i) {
+            live.push_back(RandomContact(rng, 64));
+            small.AddContact(live.back());
+        }
+        small.SearchByPrefix("a");
+        for (size_t r = 0; r < 20000; ++r) {
+            if (r % 4 != 3) {
+                size_t victim = rng() % live.size();
+                small.RemoveContact(live[victim]);
+                live.erase(live.begin() + victim);
+            } else {
+                live.push_back(RandomContact(rng, 64));
+                small.AddContact(live.back());
+            }
+            if (r % 1000 == 0) small.SearchFuzzy(typos[r % typos.size()], 2);
+        }
+        std::cout.clear();
+        PrefixSearchIndex<Contact, ContactNameKey> names(true);
+        PrefixSearchIndex<Contact, ContactPhoneKey> phoneKeys(false);
+        names.Build(live);
+        phoneKeys.Build(live);
+        bool same = true;
+        std::vector<ContactSearchHit> expected;
+        for (size_t q = 0; q < queries; ++q) {
+            names.Prefix(namePrefixes[q], 10, expected);
+            same &= SameHits(small.SearchByPrefix(namePrefixes[q]), expected);
+            names.Fuzzy(typos[q], 2, 10, expected);
+            same &= SameHits(small.SearchFuzzy(typos[q], 2), expected);
+            std::string digits = NormalizePhone(phoneTypos[q]);
+            digits[0] = '7';
+            phoneKeys.Fuzzy(digits, 2, 10, expected);
+            same &= SameHits(small.SearchFuzzy(phoneTypos[q], 2), expected);
+        }
+        std::cout << "[Incremental] " << small.Size() << " contacts after 15000 removals and 5000 additions: "
+                  << "results match a rebuilt index: " << (same ? "yes" : "no") << std::endl;
+        std::cout.setstate(std::ios::badbit);
+    }
+    std::cout.setstate(std::ios::badbit);
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include "Directory.h"
+#include "BenchUtil.h"
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+// Параметры: размеры справочника (по умолчанию 10^6 и 10^7)
+int main(int argc, char* argv[]) {
+    std::cout << "--- LR7: Cached Sort Keys ---" << std::endl;
+
+    // 1. Новые стратегии в сценарии main_strategy
+    {
+        Directory directory("Company Contacts", "Sidorov A.V.");
+        directory.AddContact(new PhysicalContact("Ivanov P.I.", "8-901-123-4567", "Moscow, Tverskaya", "ivanov@mail.ru"));
+        directory.AddContact(new LegalContact("Alpha LLC", "8-800-200-0000", "St. Petersburg, Nevsky", "LLC"));
+        directory.AddContact(new PhysicalContact("Zuev A.A.", "8-903-987-6543", "Kazan, Baumana", "zuev@corp.com"));
+        CachedSortByNameStrategy byName;
+        CachedSortByPhoneStrategy byPhone;
+        directory.SetSortStrategy(&byName);
+        directory.SortRecords();
+        directory.DisplayRecords();
+        directory.SetSortStrategy(&byPhone);
+        directory.SortRecords();
+        directory.DisplayRecords();
+    }
+
+    std::vector<size_t> sizes;
+    for (int i = 1; i < argc; ++i) sizes.push_back(std::strtoul(argv[i], nullptr, 10));
+    if (sizes.empty()) sizes = {1000000, 10000000};
+
+    SortByNameStrategy byName;
+    SortByPhoneStrategy byPhone;
+    CachedSortByNameStrategy cachedByName;
+    CachedSortByPhoneStrategy cachedByPhone;
+
+    for (size_t count : sizes) {
+        // Однофамильцы с одинаковыми инициалами встречаются часто — длинные группы равных ключей
+        std::mt19937_64 rng(count);
+        std::vector<Contact*> contacts;
+        contacts.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            std::string name = RandomName(rng, 64);
+            std::string phone = RandomPhone(rng);
+            contacts.push_back(new Contact(name, phone, "Moscow"));
+        }
+
+        std::cout << "\n--- Benchmark (" << count << " contacts) ---" << std::endl;
+        auto compare = [&](const ISortStrategy& legacy, const ISortStrategy& cached,
+                           std::string_view (Contact::*field)() const) {
+            std::vector<Contact*> a = contacts, b = contacts;
+            double legacyTime = Seconds([&] { legacy.Sort(a); });
+            double cachedTime = Seconds([&] { cached.Sort(b); });
+            bool same = true;
+            for (size_t i = 0; i < count && same; ++i) same = (a[i]->*field)() == (b[i]->*field)();
+            // Равные ключи — в исходном порядке: позиции в исходном массиве возрастают
+            std::vector<std::pair<Contact*, uint32_t>> order(count);
+            for (size_t i = 0; i < count; ++i) order[i] = {contacts[i], static_cast<uint32_t>(i)};
+            std::sort(order.begin(), order.end());
+            auto positionOf = [&](Contact* c) {
+                return std::lower_bound(order.begin(), order.end(), std::make_pair(c, uint32_t(0)))->second;
+            };
+            bool stable = true;
+            for (size_t i = 1; i < count && stable; ++i) {
+                if ((b[i - 1]->*field)() == (b[i]->*field)()) stable = positionOf(b[i - 1]) < positionOf(b[i]);
+            }
+            std::cout << "[Sort] " << legacy.GetName() << ": " << legacyTime << " s, " << cached.GetName() << ": "
+                      << cachedTime << " s (" << legacyTime / cachedTime << "x), same order: " << (same ? "yes" : "no")
+                      << ", stable: " << (stable ? "yes" : "no") << std::endl;
+        };
+        compare(byName, cachedByName, &Contact::GetName);
+        compare(byPhone, cachedByPhone, &Contact::GetPhone);
+
+        for (Contact* c : contacts) delete c;
+    }
+    return 0;
+}